@@ -1,9 +1,21 @@
 #ifndef OTHELLO_AI_ALPHABETAPRUNINGPLAYER_HPP
 #define OTHELLO_AI_ALPHABETAPRUNINGPLAYER_HPP
 
+//Standard C++:
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
 //Boost headers:
 #include <boost/random.hpp>
 //Othello headers:
+#include <othello/ai/EndgameSolver.hpp>
+#include <othello/ai/MoveOrderer.hpp>
+#include <othello/ai/OpeningBook.hpp>
+#include <othello/ai/ProbCut.hpp>
+#include <othello/ai/SearchStatistics.hpp>
+#include <othello/ai/TranspositionTable.hpp>
 #include <othello/game/IPlayer.hpp>
 #include <othello/game/Game.hpp>
 #include <othello/util/WorkerThreadManager.hpp>
@@ -21,40 +33,599 @@ namespace othello
         /// \brief An AI player that plays moves using the minimax and
         ///        alpha-beta pruning algorithms
         ///
+        /// Each move is searched with iterative deepening: one ply
+        /// deeper at a time until the search depth or the time or node
+        /// budget is reached, using the best move of the deepest search
+        /// that finished. Once few enough tiles are empty, the game is
+        /// solved instead
+        ///
+        /// The worker threads search in parallel with the shared
+        /// transposition table (Lazy SMP): while the calling thread
+        /// searches the root moves in order, each worker searches all
+        /// of them from a different move and depth, and the entries
+        /// they store speed up the calling thread's search
+        ///
+        /// With ProbCut, positions a shallower search predicts to be
+        /// outside the window are pruned without being fully searched
+        ///
+        /// With pondering, the worker threads go on helping once a move
+        /// has been picked, searching every reply of the opponent until
+        /// the player is asked for its next move. That search then finds
+        /// their results in the transposition table
+        ///
         ////////////////////////////////////////////////////////////////
         class AlphaBetaPruningPlayer : public game::IPlayer
         {
+            public:
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The value added to the final disk difference of won
+                ///        games (and taken from lost ones) when the search
+                ///        reaches the end of the game, so they're valued above
+                ///        (and below) any position the table can value
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr int64_t SOLVED_VALUE = int64_t(1) << 20u;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The algorithms the search can use
+                ///
+                ////////////////////////////////////////////////////////////////
+                enum Algorithm : uint8_t
+                {
+                    ALPHA_BETA = 0,
+                    PVS = 1, //Principal variation search (NegaScout)
+                    MTDF = 2 //MTD(f), zero window searches on the transposition table
+                };
+            
+            
             private:
         
                 ////////////////////////////////////////////////////////////////
-                /// \brief The search depth in number of moves ahead
+                /// \brief The maximum search depth in number of moves ahead
                 ///
                 ////////////////////////////////////////////////////////////////
                 unsigned int searchDepth;
                 
                 
+                ////////////////////////////////////////////////////////////////
+                /// \brief The time each move can take (0 for no limit)
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::chrono::milliseconds timePerMove;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of nodes each move can search (0 for no
+                ///        limit)
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint64_t nodesPerMove;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The algorithm the search uses
+                ///
+                ////////////////////////////////////////////////////////////////
+                Algorithm algorithm;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of empty tiles at which the game is solved
+                ///        (0 to never solve it)
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint8_t endgameEmpties;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief What solving the game finds out
+                ///
+                ////////////////////////////////////////////////////////////////
+                EndgameSolver::Mode endgameMode;
+                
+                
                 ////////////////////////////////////////////////////////////////
                 /// \brief A mersenne_twister_engine for generating random
                 ///        numbers
                 ///
                 ////////////////////////////////////////////////////////////////
                 boost::random::mt19937 randomNumberGenerator;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The transposition table, shared by the worker
+                ///        threads and kept between moves and games
+                ///
+                ////////////////////////////////////////////////////////////////
+                TranspositionTable table;
+        
         
+                ////////////////////////////////////////////////////////////////
+                /// \brief The endgame solver, which shares the transposition
+                ///        table
+                ///
+                ////////////////////////////////////////////////////////////////
+                EndgameSolver solver;
         
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief The move orderer
+                ///
+                ////////////////////////////////////////////////////////////////
+                MoveOrderer moveOrderer;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The ProbCut parameters
+                ///
+                ////////////////////////////////////////////////////////////////
+                ProbCut probCut;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \struct SearchThread
+                ///
+                /// \brief Struct containing the state of a thread's search,
+                ///        which is kept between its jobs of one search
+                ///
+                ////////////////////////////////////////////////////////////////
+                struct SearchThread
+                {
+                    
+                    ////////////////////////////////////////////////////////////////
+                    /// \brief The player and search the state is from
+                    ///
+                    ////////////////////////////////////////////////////////////////
+                    const AlphaBetaPruningPlayer* player = nullptr;
+                    uint64_t searchNumber = 0;
+                    
+                    
+                    ////////////////////////////////////////////////////////////////
+                    /// \brief Whether the thread is helping, so it stops when the
+                    ///        root moves have been searched
+                    ///
+                    ////////////////////////////////////////////////////////////////
+                    bool helper = false;
+                    
+                    
+                    ////////////////////////////////////////////////////////////////
+                    /// \brief The nodes searched that haven't been added to the
+                    ///        total yet
+                    ///
+                    ////////////////////////////////////////////////////////////////
+                    uint64_t pendingNodes = 0;
+                    
+                    
+                    ////////////////////////////////////////////////////////////////
+                    /// \brief The killer moves and history of the search
+                    ///
+                    ////////////////////////////////////////////////////////////////
+                    MoveOrderer::Heuristics heuristics;
+                    
+                    
+                    ////////////////////////////////////////////////////////////////
+                    /// \brief The statistics counted since the thread's last job
+                    ///        finished
+                    ///
+                    ////////////////////////////////////////////////////////////////
+                    SearchStatistics::Counters counters;
+                
+                };
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of searches done, so threads know when a
+                ///        new one starts
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint64_t searchNumber = 0;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief When the current move has to be played by
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::chrono::steady_clock::time_point deadline;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Whether a search of the current move has finished,
+                ///        so the rest can be stopped
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool hasResult = false;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Whether the search was stopped, checked by every
+                ///        thread at every node
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::atomic<bool> stopped;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Whether the helper threads should stop, as the root
+                ///        moves they're helping with have been searched
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::atomic<bool> helpersStopped;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The future values of the helper searches that have
+                ///        been started, which are updated when they finish
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::vector<util::FutureValue<int64_t> > helperResults;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The alpha of the root moves being searched, which is
+                ///        raised as better moves are found
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::atomic<int64_t> rootAlpha;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of nodes searched for the current move
+                ///
+                /// The threads add their nodes every NODE_CHECK_INTERVAL nodes,
+                /// when they also check the budget
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::atomic<uint64_t> nodes;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of nodes searched for every move so far
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint64_t totalNodes = 0;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The statistics of the current (or last) move's search
+                ///
+                ////////////////////////////////////////////////////////////////
+                SearchStatistics statistics;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The mutex the threads add their counters to the
+                ///        statistics with
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::mutex statisticsMutex;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Whether the statistics of each move are printed
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool logStatistics = false;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Whether the worker threads search on the opponent's
+                ///        time
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool ponder = false;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Whether the worker threads are searching on the
+                ///        opponent's time now
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool pondering = false;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The opening book played from before searching (none
+                ///        if null), which may be shared with other players
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::shared_ptr<const OpeningBook> book;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of nodes a thread searches between checks
+                ///        of the budget
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint64_t NODE_CHECK_INTERVAL = 1024;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The shallowest search the worker threads help with
+                ///        (shallower searches are over before they'd help)
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint8_t MIN_HELPER_DEPTH = 4;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief How far below the best value a move's value can be
+                ///        for the move to be picked
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr int64_t BEST_MOVE_RANGE = 20;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief How far either side of the last search's best value
+                ///        the window of the next search is
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr int64_t ASPIRATION_WINDOW = 40;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief A value larger than any board's value, used for
+                ///        windows without a bound (as it can be negated)
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr int64_t INFINITE_VALUE = INT32_MAX;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to determine if a thread should stop
+                ///        searching
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool isStopped(const SearchThread& thread) const
+                {
+                    return stopped.load(std::memory_order_relaxed) ||
+                           (thread.helper && helpersStopped.load(std::memory_order_relaxed));
+                }
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The alpha-beta recursive algorithm, in negamax form
+                ///
+                /// The children are searched by making and undoing their moves
+                /// on the given board, which is left as it was given. Results
+                /// are stored in the transposition table, and the children are
+                /// searched in the order given by the move orderer. With PVS,
+                /// the children after the first are searched with a zero window
+                /// first. With ProbCut, the board may be pruned first (the
+                /// value is then alpha or beta)
+                ///
+                /// \param thread The state of the thread's search
+                ///
+                /// \return The value of the board from the point of view of the
+                ///         player to move (fail-soft), or garbage if the search
+                ///         was stopped
+                ///
+                ////////////////////////////////////////////////////////////////
+                int64_t alphaBeta(game::Board& board, const uint8_t& depth, int64_t alpha, int64_t beta,
+                        SearchThread& thread);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to search the board after a move with a
+                ///        window, both from the point of view of the player who
+                ///        made the move
+                ///
+                /// \param player The player who made the move
+                ///
+                ////////////////////////////////////////////////////////////////
+                int64_t searchChild(game::Board& board, const uint8_t& player, const uint8_t& depth,
+                        const int64_t& alpha, const int64_t& beta, SearchThread& thread);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The MTD(f) algorithm, which finds the value of the
+                ///        board with zero window alpha-beta searches
+                ///
+                /// Each search proves the value is above or below a test value,
+                /// and the transposition table keeps the later searches from
+                /// repeating the work of the earlier ones
+                ///
+                /// \return The value of the board from the point of view of the
+                ///         player to move (a bound if it's outside the window)
+                ///
+                ////////////////////////////////////////////////////////////////
+                int64_t mtdf(game::Board& board, const uint8_t& depth, const int64_t& alpha, const int64_t& beta,
+                        SearchThread& thread);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the calling thread's search state
+                ///
+                /// \param helper Whether the thread is a helper
+                ///
+                ////////////////////////////////////////////////////////////////
+                SearchThread& getSearchThread(const bool& helper);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to search the board after a root move
+                ///
+                ////////////////////////////////////////////////////////////////
+                int64_t searchRootMove(game::Board& board, const uint8_t& player, const uint8_t& depth,
+                        const int64_t& alpha, const int64_t& beta);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to help search the root moves, as the job
+                ///        of a worker thread
+                ///
+                /// The moves are searched from a move and depth picked by the
+                /// helper number, one ply deeper each time, until the helpers
+                /// are stopped. The values are thrown away, as the point is to
+                /// fill the transposition table
+                ///
+                /// \param board The board before the root moves
+                /// \param helper The number of the helper
+                ///
+                /// \return 0
+                ///
+                ////////////////////////////////////////////////////////////////
+                int64_t helpSearch(game::Board& board, const uint8_t& player, uint8_t depth, int64_t beta,
+                        std::size_t helper);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to start a helper search on every available
+                ///        worker thread
+                ///
+                /// \param board The board before the root moves (the workers
+                ///        copy it)
+                ///
+                ////////////////////////////////////////////////////////////////
+                void startHelpers(game::Board& board, const uint8_t& player, const uint8_t& depth,
+                        const int64_t& beta);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to stop the helper searches and wait for
+                ///        them to finish, as they use the table
+                ///
+                ////////////////////////////////////////////////////////////////
+                void stopHelpers();
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to count the nodes a thread has searched,
+                ///        and stop the search if it's over budget
+                ///
+                /// \param pendingNodes The nodes the thread hasn't added yet,
+                ///        which are all added
+                ///
+                ////////////////////////////////////////////////////////////////
+                void addNodes(uint64_t& pendingNodes);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to add a thread's counters to the statistics
+                ///        once it finishes a job
+                ///
+                /// \param counters The thread's counters, which are reset
+                ///
+                ////////////////////////////////////////////////////////////////
+                void addCounters(SearchStatistics::Counters& counters);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to search some of the root moves to a depth
+                ///        with a window, with the worker threads helping
+                ///
+                /// Once a move has been searched, alpha is raised to just below
+                /// BEST_MOVE_RANGE under the best value, so the values of moves
+                /// that can't be picked are only bounds
+                ///
+                /// \param order The order to search the moves in
+                /// \param searching Which of the moves to search
+                /// \param values The values of the moves, set for the searched
+                ///        ones
+                ///
+                /// \return Whether the moves were searched (false if the search
+                ///         was stopped)
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool searchRootMoves(game::Board& board, const uint8_t& player, const game::MoveList& possibleMoves,
+                        const std::vector<std::size_t>& order, const uint8_t& depth, const int64_t& alpha, const int64_t& beta,
+                        const std::vector<bool>& searching, std::vector<int64_t>& values);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to do one iteration of iterative deepening,
+                ///        with an aspiration window around the last iteration's
+                ///        best value
+                ///
+                /// Moves that fall outside the window are searched again if
+                /// they could be within BEST_MOVE_RANGE of the best move, so
+                /// those moves always get their exact value
+                ///
+                /// \param previousBest The best value of the last iteration, or
+                ///        INT64_MIN if this is the first one
+                /// \param values The values of the moves
+                ///
+                /// \return Whether the iteration finished
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool searchIteration(game::Board& board, const uint8_t& player, const game::MoveList& possibleMoves,
+                        const uint8_t& depth, const int64_t& previousBest, std::vector<int64_t>& values);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to solve the game and pick one of the best
+                ///        moves at random
+                ///
+                /// The solve gets a quarter of the move's budget, and its nodes
+                /// are added to nodes if it runs out
+                ///
+                /// \return The move, or nullptr if the budget ran out first
+                ///
+                ////////////////////////////////////////////////////////////////
+                const game::Move* solveMove(const game::Board& board, const game::MoveList& possibleMoves);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to pick a move from the opening book
+                ///
+                /// The moves are valued by looking up the boards after them,
+                /// and one of the best ones is picked at random like after a
+                /// search. If the board is in the book but some of those
+                /// aren't, the board's best move is played
+                ///
+                /// \return The move, or nullptr if the board isn't in the book
+                ///         with a move
+                ///
+                ////////////////////////////////////////////////////////////////
+                const game::Move* bookMove(const game::Board& board, const game::MoveList& possibleMoves);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to set the time of the statistics once a
+                ///        move has been picked, and print them if enabled
+                ///
+                /// \param start When the move's search started
+                ///
+                ////////////////////////////////////////////////////////////////
+                void finishStatistics(const std::chrono::steady_clock::time_point& start);
+                
+                
                 ////////////////////////////////////////////////////////////////
-                /// \brief The alpha-beta recursive algorithm
+                /// \brief Function to start the worker threads searching on
+                ///        the opponent's time, if pondering is enabled
+                ///
+                /// The first worker searches the board after the reply the
+                /// search expects as if it was the next root, and the others
+                /// search every reply, one ply deeper at a time without a
+                /// budget. Nothing is searched if there are no workers or if
+                /// the game is over or will be solved
+                ///
+                /// \param board The board the move was picked on
+                /// \param move The picked move
                 ///
                 ////////////////////////////////////////////////////////////////
-                static int64_t alphaBeta(const game::Board& board, const uint8_t& player, const game::Move& move,
-                        uint8_t depth, int64_t alpha, int64_t beta);
+                void startPondering(const game::Board& board, const game::Move& move);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to stop the worker threads searching on the
+                ///        opponent's time and wait for them
+                ///
+                /// \return The number of positions they searched (0 if they
+                ///         weren't)
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint64_t stopPondering();
                 
         
                 ////////////////////////////////////////////////////////////////
                 /// \brief The worker thread manager
                 ///
                 ////////////////////////////////////////////////////////////////
-                util::WorkerThreadManager<int64_t, const game::Board&, const uint8_t&,
-                        const game::Move&, uint8_t, int64_t, int64_t> workerManager;
+                util::WorkerThreadManager<int64_t, game::Board&, const uint8_t&, uint8_t, int64_t,
+                        std::size_t> workerManager;
         
                 
             public:
@@ -62,16 +633,52 @@ namespace othello
                 ////////////////////////////////////////////////////////////////
                 /// \brief Class constructor that initialises the members
                 ///
-                /// \param game A const reference to the game
-                /// \param player The player number. 0 = player1, 1 = player2
-                /// \param searchDepth The search depth of the AI
-                /// \param numThreads The number of worker threads
+                /// \param searchDepth The maximum search depth of the AI
+                /// \param timePerMove The time each move can take (0 for no
+                ///        limit). The first ply is always searched
+                /// \param nodesPerMove The number of nodes each move can search
+                ///        (0 for no limit). The first ply is always searched
+                /// \param numThreads The number of worker threads helping the
+                ///        calling thread
                 /// \param seed The seed for the random generator
+                /// \param hashSize The size of the transposition table in
+                ///        bytes (0 disables it)
+                /// \param hugePages Whether to back the transposition table
+                ///        with huge pages
+                /// \param moveOrdering The ways of ordering moves to use, as
+                ///        MoveOrderer::Technique flags
+                /// \param algorithm The algorithm the search uses
+                /// \param endgameEmpties The number of empty tiles at which the
+                ///        game is solved (0 to never solve it)
+                /// \param endgameMode What solving the game finds out
+                /// \param probCut The ProbCut parameters, which may disable it
                 ///
                 ////////////////////////////////////////////////////////////////
-                AlphaBetaPruningPlayer(const unsigned int& searchDepth, const uint8_t& numThreads, const unsigned int& seed)
-                    : searchDepth(searchDepth), randomNumberGenerator(seed),
-                        workerManager(&AlphaBetaPruningPlayer::alphaBeta, numThreads) {}
+                AlphaBetaPruningPlayer(const unsigned int& searchDepth, const std::chrono::milliseconds& timePerMove,
+                        const uint64_t& nodesPerMove, const uint8_t& numThreads, const unsigned int& seed,
+                        const std::size_t& hashSize, const bool& hugePages, const uint8_t& moveOrdering,
+                        const Algorithm& algorithm, const uint8_t& endgameEmpties,
+                        const EndgameSolver::Mode& endgameMode, const ProbCut& probCut)
+                    : searchDepth(searchDepth), timePerMove(timePerMove), nodesPerMove(nodesPerMove),
+                        algorithm(algorithm), endgameEmpties(endgameEmpties), endgameMode(endgameMode),
+                        randomNumberGenerator(seed), table(hashSize, hugePages), solver(&table), moveOrderer(moveOrdering),
+                        probCut(probCut),
+                        stopped(false), helpersStopped(false), rootAlpha(0), nodes(0),
+                        workerManager(
+                                [this](game::Board& board, const uint8_t& player, uint8_t depth, int64_t beta,
+                                        std::size_t helper)
+                                {
+                                    return helpSearch(board, player, depth, beta, helper);
+                                },
+                                numThreads) {}
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Class destructor, which stops searching on the
+                ///        opponent's time
+                ///
+                ////////////////////////////////////////////////////////////////
+                ~AlphaBetaPruningPlayer() override;
                 
                 
                 ////////////////////////////////////////////////////////////////
@@ -82,7 +689,7 @@ namespace othello
                 /// \param game A const reference to the game to make a move in
                 /// \param player The index of this player in the game. (0 is
                 ///        player 1, 1 is player 2)
-                /// \param possibleMoves A vector of the possible moves
+                /// \param possibleMoves A list of the possible moves
                 ///
                 /// \return A const pointer to a const move that will be played
                 ///         by the current player. This pointer must point to a
@@ -90,7 +697,87 @@ namespace othello
                 ///
                 ////////////////////////////////////////////////////////////////
                 const game::Move* makeMove(const game::Game& game, const uint8_t& player,
-                        const std::vector<game::Move>& possibleMoves) override;
+                        const game::MoveList& possibleMoves) override;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function that is called when a game finishes, which
+                ///        stops searching on the opponent's time
+                ///
+                ////////////////////////////////////////////////////////////////
+                void gameFinished(const game::Game& game, const uint8_t& player) override;
+        
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the number of nodes searched for
+                ///        every move so far
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint64_t getNodeCount() const {return totalNodes;}
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the statistics of the last move's
+                ///        search
+                ///
+                ////////////////////////////////////////////////////////////////
+                const SearchStatistics& getLastSearchStatistics() const {return statistics;}
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to enable or disable printing the
+                ///        statistics of each move's search
+                ///
+                ////////////////////////////////////////////////////////////////
+                void enableStatisticsLog(bool log = true) {logStatistics = log;}
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to enable or disable searching on the
+                ///        opponent's time, which needs worker threads
+                ///
+                ////////////////////////////////////////////////////////////////
+                void enablePondering(bool ponder = true);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to set the opening book to play from (null
+                ///        for none)
+                ///
+                ////////////////////////////////////////////////////////////////
+                void setOpeningBook(const std::shared_ptr<const OpeningBook>& book) {this->book = book;}
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to search a board to a depth with the full
+                ///        window (or MTD(f)), on the calling thread and without
+                ///        a budget
+                ///
+                /// The transposition table is kept, so searching the same
+                /// board one ply deeper at a time is like iterative deepening
+                ///
+                /// \return The value of the board from the point of view of the
+                ///         player to move
+                ///
+                ////////////////////////////////////////////////////////////////
+                int64_t search(const game::Board& board, const uint8_t& depth);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the name of an algorithm
+                ///
+                ////////////////////////////////////////////////////////////////
+                static std::string toString(const Algorithm& algorithm);
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to read the name of an algorithm
+                ///        ("alpha-beta", "pvs" or "mtdf")
+                ///
+                /// \throws std::invalid_argument if the name isn't an algorithm
+                ///
+                ////////////////////////////////////////////////////////////////
+                static Algorithm algorithmFromString(const std::string& str);
         
         };
         
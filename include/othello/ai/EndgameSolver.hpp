@@ -0,0 +1,243 @@
+#ifndef OTHELLO_AI_ENDGAMESOLVER_HPP
+#define OTHELLO_AI_ENDGAMESOLVER_HPP
+
+//Standard C++:
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+//Othello headers:
+#include <othello/ai/TranspositionTable.hpp>
+#include <othello/game/Board.hpp>
+
+
+namespace othello
+{
+
+    namespace ai
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \class EndgameSolver
+        ///
+        /// \brief Class for solving positions near the end of the game,
+        ///        by searching every move to the end of the game
+        ///
+        /// Positions are valued by the final disk difference from the
+        /// point of view of the player to move, either exactly or only
+        /// as a win, loss or draw (which has more cutoffs). The search
+        /// uses:
+        ///  - fastest-first ordering (fewest moves for the opponent)
+        ///    with many empty tiles, and parity ordering (quadrants with
+        ///    an odd number of empty tiles first) with few
+        ///  - stability cutoffs, as stable disks bound the final score
+        ///  - an optional transposition table, which can be shared with
+        ///    a search that stores other values
+        ///
+        ////////////////////////////////////////////////////////////////
+        class EndgameSolver
+        {
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief What the solver finds out about a position
+                ///
+                ////////////////////////////////////////////////////////////////
+                enum Mode : uint8_t
+                {
+                    EXACT = 0, //The final disk difference
+                    WLD = 1 //Only whether it's a win, loss or draw
+                };
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The largest disk difference a game can end with
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr int MAX_SCORE = game::Board::BOARD_SIZE * game::Board::BOARD_SIZE;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of empty tiles at which parity ordering
+                ///        replaces fastest-first ordering
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint8_t PARITY_EMPTIES = 7;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The fewest empty tiles a position can have to be
+                ///        looked up in the table or checked for stable disks
+                ///        (it costs more than searching smaller positions)
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint8_t TABLE_EMPTIES = 7;
+                static constexpr uint8_t STABILITY_EMPTIES = 6;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief A key mixed into the hashes of solved positions, so
+                ///        they don't mix with the other entries of a shared
+                ///        table
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr game::hash_t TABLE_KEY = 0x5D0C1A7E9B3F2468ULL;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of positions searched between checks of
+                ///        the budget
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint64_t NODE_CHECK_INTERVAL = 1024;
+
+
+            private:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The transposition table (nullptr if there isn't one)
+                ///
+                ////////////////////////////////////////////////////////////////
+                TranspositionTable* table;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of positions searched
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint64_t nodes = 0;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The budget of each solve (0 for no limit)
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::chrono::milliseconds timeLimit{0};
+                uint64_t nodeLimit = 0;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The end of the current solve's budget, and the node
+                ///        count the budget is checked at next
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::chrono::steady_clock::time_point deadline;
+                uint64_t lastNode = 0;
+                uint64_t nextCheck = 0;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Whether the current (or last) solve ran out of budget
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool aborted = false;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to check the budget every so many nodes,
+                ///        aborting the solve if it has run out
+                ///
+                /// \return Whether the solve is aborted
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool isOverBudget();
+
+
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Class constructor
+                ///
+                /// \param table The transposition table to use, or nullptr
+                ///
+                ////////////////////////////////////////////////////////////////
+                explicit EndgameSolver(TranspositionTable* table = nullptr) : table(table) {}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The alpha-beta search to the end of the game, in
+                ///        negamax form
+                ///
+                /// Moves are made and undone on the given board, which is
+                /// left as it was given
+                ///
+                /// \return The final disk difference from the point of view of
+                ///         the player to move (fail-soft, so a bound if it's
+                ///         outside the window), or 0 if the solve is aborted
+                ///
+                ////////////////////////////////////////////////////////////////
+                int search(game::Board& board, int alpha, int beta);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to solve a position and find its best moves
+                ///
+                /// \param board The position, which mustn't be over
+                /// \param mode What to find out about the position
+                /// \param bestSquares The output, the bit indexes of every move
+                ///        with the best result (in tile order)
+                ///
+                /// \return The final disk difference with the best moves, from
+                ///         the point of view of the player to move (-1, 0 or 1
+                ///         in WLD mode). If the budget runs out, 0 with no best
+                ///         moves (see isAborted)
+                ///
+                ////////////////////////////////////////////////////////////////
+                int solve(const game::Board& board, const Mode& mode, std::vector<uint8_t>& bestSquares);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to set the budget of each solve, which is
+                ///        aborted if it runs out
+                ///
+                /// Nothing is stored in the table once a solve is aborted, so
+                /// the table only has solved positions
+                ///
+                /// \param timeLimit The time each solve can take (0 for no
+                ///        limit)
+                /// \param nodeLimit The number of positions each solve can
+                ///        search (0 for no limit)
+                ///
+                ////////////////////////////////////////////////////////////////
+                void setBudget(const std::chrono::milliseconds& timeLimit, const uint64_t& nodeLimit);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to determine if the last solve ran out of
+                ///        budget
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool isAborted() const {return aborted;}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the number of positions searched
+                ///        so far
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint64_t getNodeCount() const {return nodes;}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the name of a mode
+                ///
+                ////////////////////////////////////////////////////////////////
+                static std::string toString(const Mode& mode);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to read a mode from its name ("exact" or
+                ///        "wld")
+                ///
+                /// \throws std::invalid_argument if the name isn't a mode
+                ///
+                ////////////////////////////////////////////////////////////////
+                static Mode modeFromString(const std::string& str);
+
+        };
+
+    }
+
+}
+
+#endif //OTHELLO_AI_ENDGAMESOLVER_HPP
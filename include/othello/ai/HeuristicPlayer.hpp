@@ -22,6 +22,15 @@ namespace othello
         ////////////////////////////////////////////////////////////////
         class HeuristicPlayer : public game::IPlayer
         {
+            private:
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The batch the boards after each move are evaluated in
+                ///
+                ////////////////////////////////////////////////////////////////
+                game::BoardBatch batch;
+                
+                
             public:
                 
                 ////////////////////////////////////////////////////////////////
@@ -32,7 +41,7 @@ namespace othello
                 /// \param game A const reference to the game to make a move in
                 /// \param player The index of this player in the game. (0 is
                 ///        player 1, 1 is player 2)
-                /// \param possibleMoves A vector of the possible moves
+                /// \param possibleMoves A list of the possible moves
                 ///
                 /// \return A const pointer to a const move that will be played
                 ///         by the current player. This pointer must point to a
@@ -40,30 +49,24 @@ namespace othello
                 ///
                 ////////////////////////////////////////////////////////////////
                 const game::Move* makeMove(const game::Game& game, const uint8_t& player,
-                        const std::vector<game::Move>& possibleMoves) override
+                        const game::MoveList& possibleMoves) override
                 {
                     std::pair<std::size_t, int64_t> bestMove = {0, INT64_MIN};
                     
                     //todo maybe worker thread manager
                     
+                    //Evaluate every move at once (in the same order as possibleMoves)
+                    int64_t values[game::MoveList::MAX_MOVES];
+                    ai::MoveEvaluator::evaluateChildren(game.getBoard(), player, batch, values);
+                    
                     //Iterate over the possible moves
-                    game::Board tmpBoard;
-                    int64_t tmpValue;
-                    for (std::size_t i = 0; i < game.getBoard().getPossibleMoves().size(); ++i)
+                    for (std::size_t i = 0; i < possibleMoves.size(); ++i)
                     {
-                        //Copy the board
-                        tmpBoard = game.getBoard();
-                        //Make the move
-                        tmpBoard.makeMove(&tmpBoard.getPossibleMoves()[i]);
-                        
-                        //Calculate its value
-                        tmpValue = ai::MoveEvaluator::evaluate(tmpBoard, player);
-                        
                         //If it's better
-                        if (tmpValue > bestMove.second)
+                        if (values[i] > bestMove.second)
                         {
                             bestMove.first = i;
-                            bestMove.second = tmpValue;
+                            bestMove.second = values[i];
                         }
                     }
                     
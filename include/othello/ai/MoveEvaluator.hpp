@@ -6,6 +6,7 @@
 #include <mutex>
 //Othello headers:
 #include <othello/game/Board.hpp>
+#include <othello/game/BoardBatch.hpp>
 
 namespace othello
 {
@@ -30,7 +31,10 @@ namespace othello
                 ////////////////////////////////////////////////////////////////
                 /// \brief The positional table used to value potential states
                 ///
+                /// There is a table for each supported board size
+                ///
                 ////////////////////////////////////////////////////////////////
+                #if OTHELLO_BOARD_SIZE == 8
                 static constexpr int table[game::Board::BOARD_SIZE][game::Board::BOARD_SIZE] =
                         {
                                 {100, -25, 10, 5, 5, 10, -25, 100},
@@ -42,6 +46,19 @@ namespace othello
                                 { 25, -25,  2, 2, 2,  2, -25, -25},
                                 {100, -25, 10, 5, 5, 10, -25, 100}
                         };
+                #elif OTHELLO_BOARD_SIZE == 6
+                static constexpr int table[game::Board::BOARD_SIZE][game::Board::BOARD_SIZE] =
+                        {
+                                {100, -25, 10, 10, -25, 100},
+                                {-25, -25,  2,  2, -25, -25},
+                                { 10,   2,  1,  1,   2,  10},
+                                { 10,   2,  1,  1,   2,  10},
+                                {-25, -25,  2,  2, -25, -25},
+                                {100, -25, 10, 10, -25, 100}
+                        };
+                #else
+                #error "MoveEvaluator has no positional table for this board size"
+                #endif
                 
                 
             public:
@@ -57,6 +74,42 @@ namespace othello
                 ///
                 ////////////////////////////////////////////////////////////////
                 static int64_t evaluate(const game::Board& board, const uint8_t& player);
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Static function to evaluate every board in a batch
+                ///
+                /// Gives the same values as evaluate, but the tiles are grouped
+                /// by their value in the table so each group is a mask and a
+                /// population count, done for several boards at once
+                ///
+                /// \param batch The boards to evaluate
+                /// \param player Which player's perspective the boards should
+                ///        be valued from
+                /// \param values The output, one value per board
+                ///
+                ////////////////////////////////////////////////////////////////
+                static void evaluate(const game::BoardBatch& batch, const uint8_t& player, int64_t* values);
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Static function to evaluate the board after each of
+                ///        the current player's possible moves, as one batch
+                ///
+                /// \param board The board to make the moves on
+                /// \param player Which player's perspective the boards should
+                ///        be valued from
+                /// \param batch A batch to hold the children. It's cleared
+                ///        first, and afterwards holds the children in the order
+                ///        of the tiles (the same order as getPossibleMoves)
+                /// \param values The output, one value per possible move. Must
+                ///        have room for game::MoveList::MAX_MOVES values
+                ///
+                /// \return The number of possible moves
+                ///
+                ////////////////////////////////////////////////////////////////
+                static std::size_t evaluateChildren(const game::Board& board, const uint8_t& player,
+                        game::BoardBatch& batch, int64_t* values);
             
         };
         
@@ -64,4 +117,4 @@ namespace othello
     
 }
 
-#endif //OTHELLO_AI_TRANSPOSITIONTABLE_HPP
+#endif //OTHELLO_AI_MOVEEVALUATOR_HPP
@@ -0,0 +1,218 @@
+#ifndef OTHELLO_AI_MOVEORDERER_HPP
+#define OTHELLO_AI_MOVEORDERER_HPP
+
+//Standard C++:
+#include <cstdint>
+#include <string>
+//Othello headers:
+#include <othello/game/Board.hpp>
+
+
+namespace othello
+{
+
+    namespace ai
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \class MoveOrderer
+        ///
+        /// \brief Class for ordering the moves of a position in a search,
+        ///        so the moves most likely to be best are searched first
+        ///        and cause cutoffs sooner
+        ///
+        /// Each way of valuing moves can be turned on and off, so their
+        /// effect on the number of nodes searched can be measured. In
+        /// order of priority, the moves are valued by:
+        ///  - whether it's the best move in the transposition table
+        ///  - whether it's a killer move (caused a cutoff at the same
+        ///    depth)
+        ///  - a shallow search, if the caller did one
+        ///  - corners first and X-squares (next to corners
+        ///    diagonally) last
+        ///  - fewest moves for the opponent (fastest-first), near the
+        ///    end of the game
+        ///  - the history of cutoffs caused by the move
+        ///
+        ////////////////////////////////////////////////////////////////
+        class MoveOrderer
+        {
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The ways of valuing moves, as bit flags
+                ///
+                ////////////////////////////////////////////////////////////////
+                enum Technique : uint8_t
+                {
+                    NONE = 0,
+                    TT_MOVE = 1u << 0u,
+                    KILLERS = 1u << 1u,
+                    HISTORY = 1u << 2u,
+                    SQUARES = 1u << 3u, //Corners first and X-squares last
+                    FASTEST_FIRST = 1u << 4u,
+                    SHALLOW_SEARCH = 1u << 5u,
+                    ALL = TT_MOVE | KILLERS | HISTORY | SQUARES | FASTEST_FIRST | SHALLOW_SEARCH
+                };
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The deepest search the killer moves are kept for
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint8_t MAX_DEPTH = game::Board::BOARD_SIZE * game::Board::BOARD_SIZE;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of empty tiles at which fastest-first is
+                ///        used
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint8_t FASTEST_FIRST_EMPTIES = 18;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The depth at which positions without a best move in
+                ///        the transposition table should be ordered by a
+                ///        shallow search
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint8_t SHALLOW_SEARCH_DEPTH = 5;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief How much shallower than the children the shallow
+                ///        search is
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint8_t SHALLOW_SEARCH_REDUCTION = 3;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \struct Heuristics
+                ///
+                /// \brief Struct containing what a search thread has learnt
+                ///        about which moves cause cutoffs
+                ///
+                ////////////////////////////////////////////////////////////////
+                struct Heuristics
+                {
+
+                    ////////////////////////////////////////////////////////////////
+                    /// \brief The last 2 moves that caused a cutoff at each depth
+                    ///        (NO_MOVE if there aren't any)
+                    ///
+                    ////////////////////////////////////////////////////////////////
+                    uint8_t killers[MAX_DEPTH + 1][2];
+
+
+                    ////////////////////////////////////////////////////////////////
+                    /// \brief The cutoffs caused by each player's moves to each
+                    ///        tile, weighted by depth squared
+                    ///
+                    ////////////////////////////////////////////////////////////////
+                    uint32_t history[2][64];
+
+
+                    ////////////////////////////////////////////////////////////////
+                    /// \brief Function to forget the killers and most of the
+                    ///        history, before a new search
+                    ///
+                    ////////////////////////////////////////////////////////////////
+                    void newSearch();
+
+
+                    ////////////////////////////////////////////////////////////////
+                    /// \brief Function to record a move that caused a cutoff
+                    ///
+                    ////////////////////////////////////////////////////////////////
+                    void addCutoff(const uint8_t& player, const uint8_t& square, const uint8_t& depth);
+
+                };
+
+
+            private:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The techniques that are used
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint8_t techniques;
+
+
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Class constructor
+                ///
+                /// \param techniques The techniques to use, as Technique flags
+                ///
+                ////////////////////////////////////////////////////////////////
+                explicit MoveOrderer(const uint8_t& techniques) : techniques(techniques) {}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to determine if a technique is used
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool isUsing(const Technique& technique) const {return techniques & technique;}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to determine if a position should be
+                ///        ordered by a shallow search of its children
+                ///
+                /// \param depth The depth the position is being searched to
+                /// \param ttMove The best move in the transposition table
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool shouldSearchShallow(const uint8_t& depth, const uint8_t& ttMove) const;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to order the legal moves of a position
+                ///
+                /// \param board The position
+                /// \param ttMove The bit index of the best move in the
+                ///        transposition table (TranspositionTable::NO_MOVE if
+                ///        there isn't one, or it isn't legal)
+                /// \param depth The depth the position is being searched to
+                /// \param heuristics The search thread's killers and history
+                /// \param shallowValues The values of the moves in tile order,
+                ///        from the point of view of the player to move, or
+                ///        nullptr if no shallow search was done
+                /// \param squares The output, the bit indexes of the moves, best
+                ///        first. Must have room for game::MoveList::MAX_MOVES
+                ///
+                /// \return The number of moves
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::size_t orderMoves(const game::Board& board, const uint8_t& ttMove, const uint8_t& depth,
+                        const Heuristics& heuristics, const int64_t* shallowValues, uint8_t* squares) const;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the names of techniques as a comma
+                ///        separated list ("none" if there are none)
+                ///
+                ////////////////////////////////////////////////////////////////
+                static std::string toString(const uint8_t& techniques);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to read a comma separated list of technique
+                ///        names ("tt", "killers", "history", "squares",
+                ///        "fastest-first", "shallow-search", "all" or "none")
+                ///
+                /// \throws std::invalid_argument if a name isn't a technique
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint8_t fromString(const std::string& str);
+
+        };
+
+    }
+
+}
+
+#endif //OTHELLO_AI_MOVEORDERER_HPP
@@ -0,0 +1,194 @@
+#ifndef OTHELLO_AI_OPENINGBOOK_HPP
+#define OTHELLO_AI_OPENINGBOOK_HPP
+
+//Standard C++:
+#include <cstdint>
+#include <string>
+//Othello headers:
+#include <othello/game/Board.hpp>
+
+
+namespace othello
+{
+
+    namespace ai
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \class OpeningBook
+        ///
+        /// \brief Class for looking up the values and best moves of
+        ///        opening positions in a book file
+        ///
+        /// The file is a header followed by an array of entries sorted by
+        /// hash, so it's memory-mapped read-only (and shared by every
+        /// process using it) and searched with a binary search. Positions
+        /// are stored once for all their symmetries, by the hash of their
+        /// canonical form (see game::Board::getCanonical), with their
+        /// best move on the canonical board
+        ///
+        /// Books are made by build, which stores every position up to a
+        /// number of moves from the start: the last ones valued by a deep
+        /// search and the others by minimax
+        ///
+        ////////////////////////////////////////////////////////////////
+        class OpeningBook
+        {
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \struct Entry
+                ///
+                /// \brief Struct containing one position of the book
+                ///
+                ////////////////////////////////////////////////////////////////
+                struct Entry
+                {
+                    game::hash_t hash; //The hash of the canonical board
+                    int32_t value; //From the point of view of the player to move
+                    uint8_t move; //The best move's bit index (NO_MOVE for the last positions)
+                    uint8_t reserved[3];
+                };
+                static_assert(sizeof(Entry) == 16, "Book entries are written to files as they are");
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The move of the positions without one
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint8_t NO_MOVE = 0xFF;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The version of the file format
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint32_t VERSION = 1;
+
+
+            private:
+
+                ////////////////////////////////////////////////////////////////
+                /// \struct Header
+                ///
+                /// \brief Struct containing the start of a book file
+                ///
+                ////////////////////////////////////////////////////////////////
+                struct Header
+                {
+                    char magic[8];
+                    uint32_t version;
+                    uint32_t boardSize;
+                    uint64_t numEntries;
+                };
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The bytes every book file starts with
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr char MAGIC[8] = {'O', 'T', 'H', 'B', 'O', 'O', 'K', '\0'};
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The mapped file (and on Windows, the mapping)
+                ///
+                ////////////////////////////////////////////////////////////////
+                const void* mapping = nullptr;
+                std::size_t mappingSize = 0;
+                void* mappingHandle = nullptr;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The entries, sorted by hash
+                ///
+                ////////////////////////////////////////////////////////////////
+                const Entry* entries = nullptr;
+                std::size_t numEntries = 0;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to unmap the file, if it's mapped
+                ///
+                ////////////////////////////////////////////////////////////////
+                void unmap();
+
+
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Class constructor that maps a book file
+                ///
+                /// \throws std::runtime_error if the file can't be mapped or
+                ///         isn't a book for this board size
+                ///
+                ////////////////////////////////////////////////////////////////
+                explicit OpeningBook(const std::string& path);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Class destructor, which unmaps the file
+                ///
+                ////////////////////////////////////////////////////////////////
+                ~OpeningBook();
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Deleted copy constructor and assignment, as the
+                ///        mapping is owned
+                ///
+                ////////////////////////////////////////////////////////////////
+                OpeningBook(const OpeningBook&) = delete;
+                OpeningBook& operator=(const OpeningBook&) = delete;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to look a board up
+                ///
+                /// \param entry The output, the board's entry with its move
+                ///        turned back to the board's orientation
+                ///
+                /// \return Whether the board is in the book
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool probe(const game::Board& board, Entry& entry) const;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the number of positions in the book
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::size_t size() const {return numEntries;}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to build a book and write it to a file
+                ///
+                /// Every position up to bookDepth moves from the start is
+                /// found (once for all its symmetries). The last ones, and any
+                /// that are over, are valued by a search to searchDepth (split
+                /// between the threads) and the others get the best of their
+                /// children's values
+                ///
+                /// \param bookDepth The number of moves from the start
+                /// \param searchDepth The depth of the searches
+                /// \param numThreads The number of threads searching
+                /// \param hashSize The size of each thread's transposition
+                ///        table in bytes
+                /// \param seed The seed for the searches
+                ///
+                /// \return The number of positions in the book
+                ///
+                /// \throws std::runtime_error if the file can't be written
+                ///
+                ////////////////////////////////////////////////////////////////
+                static std::size_t build(const std::string& path, const uint8_t& bookDepth, const uint8_t& searchDepth,
+                        const unsigned int& numThreads, const std::size_t& hashSize, const unsigned int& seed);
+
+        };
+
+    }
+
+}
+
+#endif //OTHELLO_AI_OPENINGBOOK_HPP
@@ -0,0 +1,218 @@
+#ifndef OTHELLO_AI_PROBCUT_HPP
+#define OTHELLO_AI_PROBCUT_HPP
+
+//Standard C++:
+#include <cstdint>
+#include <string>
+//Othello headers:
+#include <othello/game/Board.hpp>
+
+
+namespace othello
+{
+
+    namespace ai
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \class ProbCut
+        ///
+        /// \brief Class containing the parameters of ProbCut, which
+        ///        prunes positions that a shallow search predicts a deep
+        ///        search would fail high or low on
+        ///
+        /// The value of a deep search is modelled as a linear function of
+        /// the value of a shallow search plus normally distributed error:
+        /// `deep = slope * shallow + intercept + error`. A deep search is
+        /// then predicted to fail high if the shallow value is far enough
+        /// above the bound (threshold times the error's standard
+        /// deviation), which a zero window shallow search tells cheaply
+        ///
+        /// Each depth has a check for each of the REDUCTIONS, tried in
+        /// order (Multi-ProbCut), and the parameters of each check are
+        /// fitted by calibrate from positions of self-play games. Depths
+        /// deeper than the calibrated ones use the parameters of the
+        /// deepest calibrated depth with the same parity
+        ///
+        ////////////////////////////////////////////////////////////////
+        class ProbCut
+        {
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \struct Parameters
+                ///
+                /// \brief Struct containing the model of one check (unused if
+                ///        the slope is 0)
+                ///
+                ////////////////////////////////////////////////////////////////
+                struct Parameters
+                {
+                    double slope;
+                    double intercept;
+                    double sigma; //The standard deviation of the error
+                };
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of checks of each depth
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint8_t NUM_CHECKS = 2;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief How much shallower than the depth the shallow search
+                ///        of each check is, cheapest first (they're even so
+                ///        the same player moves last)
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint8_t REDUCTIONS[NUM_CHECKS] = {4, 2};
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The shallowest depth that can be pruned
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint8_t MIN_DEPTH = 3;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The deepest depth that can be calibrated
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint8_t MAX_DEPTH = game::Board::BOARD_SIZE * game::Board::BOARD_SIZE;
+
+
+            private:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief How many standard deviations the shallow value has
+                ///        to be past a bound to prune (0 disables ProbCut)
+                ///
+                ////////////////////////////////////////////////////////////////
+                double threshold;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The parameters of each check of each depth
+                ///
+                ////////////////////////////////////////////////////////////////
+                Parameters parameters[MAX_DEPTH + 1][NUM_CHECKS] = {};
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The deepest depth with parameters
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint8_t maxCalibratedDepth = 0;
+
+
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Class constructor that uses the built in parameters,
+                ///        calibrated for the 8x8 board (there are none for
+                ///        other sizes)
+                ///
+                /// \param threshold How many standard deviations the shallow
+                ///        value has to be past a bound to prune (0 disables
+                ///        ProbCut)
+                ///
+                ////////////////////////////////////////////////////////////////
+                explicit ProbCut(const double& threshold);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to determine if positions searched to a
+                ///        depth can be pruned
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool isUsing(const uint8_t& depth) const
+                {
+                    return threshold > 0 && maxCalibratedDepth && depth >= MIN_DEPTH;
+                }
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the parameters of a check of a depth
+                ///
+                ////////////////////////////////////////////////////////////////
+                const Parameters& getParameters(const uint8_t& depth, const uint8_t& check) const;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the value the shallow search has to
+                ///        reach to predict that the deep search fails high
+                ///
+                ////////////////////////////////////////////////////////////////
+                int64_t getHighBound(const Parameters& check, const int64_t& beta) const;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the value the shallow search has to
+                ///        stay at or below to predict that the deep search
+                ///        fails low
+                ///
+                ////////////////////////////////////////////////////////////////
+                int64_t getLowBound(const Parameters& check, const int64_t& alpha) const;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the threshold, in standard
+                ///        deviations
+                ///
+                ////////////////////////////////////////////////////////////////
+                const double& getThreshold() const {return threshold;}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to read the parameters from a file written
+                ///        by save, replacing all of them
+                ///
+                /// \throws std::runtime_error if the file can't be read
+                ///
+                ////////////////////////////////////////////////////////////////
+                void load(const std::string& path);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to write the parameters to a file, one check
+                ///        per line ("depth reduction slope intercept sigma")
+                ///
+                /// \throws std::runtime_error if the file can't be written
+                ///
+                ////////////////////////////////////////////////////////////////
+                void save(const std::string& path) const;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to fit the parameters from positions of
+                ///        self-play games
+                ///
+                /// The games are played by a depth 2 search after a few random
+                /// moves, and every position before the endgame is searched
+                /// to every depth up to maxDepth. The parameters of each check
+                /// are the least squares fit of the deep values to the shallow
+                /// ones
+                ///
+                /// \param numGames The number of games to play
+                /// \param maxDepth The deepest depth to calibrate
+                /// \param seed The seed for the random generators
+                /// \param hashSize The size of the transposition table in
+                ///        bytes
+                ///
+                /// \return ProbCut with the fitted parameters and the given
+                ///         threshold
+                ///
+                ////////////////////////////////////////////////////////////////
+                static ProbCut calibrate(const unsigned int& numGames, const uint8_t& maxDepth,
+                        const unsigned int& seed, const std::size_t& hashSize, const double& threshold);
+
+        };
+
+    }
+
+}
+
+#endif //OTHELLO_AI_PROBCUT_HPP
@@ -162,7 +162,7 @@ namespace othello
                 /// \param game A const reference to the game to make a move in
                 /// \param player The index of this player in the game. (0 is
                 ///        player 1, 1 is player 2)
-                /// \param possibleMoves A vector of the possible moves
+                /// \param possibleMoves A list of the possible moves
                 ///
                 /// \return A const pointer to a const move that will be played
                 ///         by the current player. This pointer must point to a
@@ -170,7 +170,7 @@ namespace othello
                 ///
                 ////////////////////////////////////////////////////////////////
                 const game::Move* makeMove(const game::Game& game, const uint8_t& player,
-                                           const std::vector<game::Move>& possibleMoves) override;
+                                           const game::MoveList& possibleMoves) override;
                 
                 
                 ////////////////////////////////////////////////////////////////
@@ -50,7 +50,7 @@ namespace othello
                 ///        move. This function simply picks a random move in
                 ///        possibleMoves
                 ///
-                /// \param possibleMoves A vector of the possible moves
+                /// \param possibleMoves A list of the possible moves
                 ///
                 /// \return A const pointer to a const move that will be played
                 ///         by the current player. This pointer must point to a
@@ -58,7 +58,7 @@ namespace othello
                 ///
                 ////////////////////////////////////////////////////////////////
                 const game::Move* makeMove(const game::Game&, const uint8_t&,
-                        const std::vector<game::Move>& possibleMoves) override
+                        const game::MoveList& possibleMoves) override
                 {
                     //Create a uniform integer distribution
                     boost::random::uniform_int_distribution<> distribution(0, possibleMoves.size() - 1);
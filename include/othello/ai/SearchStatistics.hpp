@@ -0,0 +1,199 @@
+#ifndef OTHELLO_AI_SEARCHSTATISTICS_HPP
+#define OTHELLO_AI_SEARCHSTATISTICS_HPP
+
+//Standard C++:
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+
+namespace othello
+{
+
+    namespace ai
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \struct SearchStatistics
+        ///
+        /// \brief Struct containing what a search of one move did, for
+        ///        tuning the depth and number of threads
+        ///
+        /// The counters are counted by each thread separately and added
+        /// together when the thread finishes a job, so counting them
+        /// doesn't slow the threads down
+        ///
+        ////////////////////////////////////////////////////////////////
+        struct SearchStatistics
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \struct Counters
+            ///
+            /// \brief Struct containing the counters of one thread
+            ///
+            ////////////////////////////////////////////////////////////////
+            struct Counters
+            {
+                uint64_t leaves = 0; //Positions evaluated or solved without searching deeper
+                uint64_t cutoffs = 0; //Positions with a beta cutoff
+                uint64_t firstMoveCutoffs = 0; //Cutoffs by the first move searched
+                uint64_t probCuts = 0; //Positions pruned by ProbCut
+                uint64_t tableProbes = 0;
+                uint64_t tableHits = 0;
+                uint64_t tableStores = 0;
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to add another thread's counters
+                ///
+                ////////////////////////////////////////////////////////////////
+                Counters& operator+=(const Counters& other);
+            };
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \struct Iteration
+            ///
+            /// \brief Struct containing one iteration of iterative deepening
+            ///
+            ////////////////////////////////////////////////////////////////
+            struct Iteration
+            {
+                uint8_t depth;
+                uint64_t nodes;
+                double seconds;
+                bool finished; //False if the budget ran out during it
+            };
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \struct RootMove
+            ///
+            /// \brief Struct containing the time spent on a root move, over
+            ///        every iteration
+            ///
+            ////////////////////////////////////////////////////////////////
+            struct RootMove
+            {
+                uint8_t square;
+                double seconds;
+            };
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The counters of every thread
+            ///
+            ////////////////////////////////////////////////////////////////
+            Counters counters;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The number of positions searched by every thread
+            ///
+            ////////////////////////////////////////////////////////////////
+            uint64_t nodes = 0;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The number of positions searched on the opponent's
+            ///        time before the search (which it can find in the
+            ///        transposition table)
+            ///
+            ////////////////////////////////////////////////////////////////
+            uint64_t ponderNodes = 0;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The time the search took
+            ///
+            ////////////////////////////////////////////////////////////////
+            double seconds = 0;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The deepest iteration that finished (0 if the game
+            ///        was solved)
+            ///
+            ////////////////////////////////////////////////////////////////
+            uint8_t depth = 0;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Whether the game was solved instead of searched
+            ///
+            ////////////////////////////////////////////////////////////////
+            bool solved = false;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Whether the move was played from the opening book
+            ///        instead of searched
+            ///
+            ////////////////////////////////////////////////////////////////
+            bool book = false;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The iterations, shallowest first
+            ///
+            ////////////////////////////////////////////////////////////////
+            std::vector<Iteration> iterations;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The root moves, in the order of the possible moves
+            ///
+            ////////////////////////////////////////////////////////////////
+            std::vector<RootMove> rootMoves;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the number of positions searched per
+            ///        second
+            ///
+            ////////////////////////////////////////////////////////////////
+            double getNodesPerSecond() const;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the fraction of cutoffs that were by
+            ///        the first move searched, which is how good the move
+            ///        ordering is
+            ///
+            ////////////////////////////////////////////////////////////////
+            double getFirstMoveCutoffRate() const;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the fraction of table probes that
+            ///        found the position
+            ///
+            ////////////////////////////////////////////////////////////////
+            double getTableHitRate() const;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the effective branching factor, how
+            ///        many times more positions each iteration searched
+            ///        than the last (on average, over the finished
+            ///        iterations)
+            ///
+            /// \return The branching factor, or 0 if fewer than 2
+            ///         iterations finished
+            ///
+            ////////////////////////////////////////////////////////////////
+            double getEffectiveBranchingFactor() const;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to write the statistics in a few lines
+            ///
+            ////////////////////////////////////////////////////////////////
+            void print(std::ostream& out) const;
+        };
+
+    }
+
+}
+
+#endif //OTHELLO_AI_SEARCHSTATISTICS_HPP
@@ -0,0 +1,244 @@
+#ifndef OTHELLO_AI_TRANSPOSITIONTABLE_HPP
+#define OTHELLO_AI_TRANSPOSITIONTABLE_HPP
+
+//Standard C++:
+#include <atomic>
+#include <cstdint>
+//Othello headers:
+#include <othello/game/Zobrist.hpp>
+
+
+namespace othello
+{
+
+    namespace ai
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \class TranspositionTable
+        ///
+        /// \brief Fixed size hash table of search results, shared by
+        ///        every thread of a search without locks
+        ///
+        /// The table is split into 64 byte buckets (one cache line) of
+        /// 4 entries. An entry is two 64 bit words, the data and the
+        /// hash XORed with the data, so an entry that was torn by two
+        /// threads writing it at once doesn't match its position and is
+        /// ignored
+        ///
+        /// When a bucket is full, the entry from the oldest search is
+        /// replaced, and the shallowest one if they're from the same
+        /// search. Entries are kept between searches, so a search can
+        /// use the results of the searches before it
+        ///
+        ////////////////////////////////////////////////////////////////
+        class TranspositionTable
+        {
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The kind of value stored in an entry
+                ///
+                ////////////////////////////////////////////////////////////////
+                enum Bound : uint8_t
+                {
+                    NONE = 0,
+                    UPPER = 1, //The search failed low, the value is at most this
+                    LOWER = 2, //The search failed high, the value is at least this
+                    EXACT = 3
+                };
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The move stored in entries that have no best move
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint8_t NO_MOVE = 0xFF;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \struct Entry
+                ///
+                /// \brief Struct containing a search result, unpacked from the
+                ///        table
+                ///
+                /// The value is from the point of view of the player to move
+                /// in the position
+                ///
+                ////////////////////////////////////////////////////////////////
+                struct Entry
+                {
+                    int32_t value;
+                    uint8_t depth;
+                    Bound bound;
+                    uint8_t move;
+                };
+
+
+            private:
+
+                ////////////////////////////////////////////////////////////////
+                /// \struct Slot
+                ///
+                /// \brief Struct containing a packed entry
+                ///
+                ////////////////////////////////////////////////////////////////
+                struct Slot
+                {
+                    std::atomic<uint64_t> key;
+                    std::atomic<uint64_t> data;
+                };
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of entries in a bucket
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr std::size_t BUCKET_SIZE = 4;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \struct Bucket
+                ///
+                /// \brief Struct containing the entries that share an index,
+                ///        in one cache line
+                ///
+                ////////////////////////////////////////////////////////////////
+                struct alignas(64) Bucket
+                {
+                    Slot slots[BUCKET_SIZE];
+                };
+
+
+                ////////////////////////////////////////////////////////////////
+                static_assert(sizeof(Bucket) == 64, "A bucket should fill a cache line");
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The buckets (a power of 2 in number, or none)
+                ///
+                ////////////////////////////////////////////////////////////////
+                Bucket* buckets = nullptr;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of buckets
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::size_t numBuckets = 0;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Whether the buckets are in memory that was allocated
+                ///        for huge pages
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool hugePages = false;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of the current search, used to find old
+                ///        entries (6 bits)
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint8_t generation = 0;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the bucket a position is stored in
+                ///
+                /// \warning The table mustn't be empty
+                ///
+                ////////////////////////////////////////////////////////////////
+                Bucket& getBucket(const game::hash_t& hash) const {return buckets[hash & (numBuckets - 1)];}
+
+
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Class constructor
+                ///
+                /// \param size The maximum size of the table in bytes. If it
+                ///        is smaller than a bucket, the table stores nothing
+                /// \param useHugePages Whether to ask the OS to back the
+                ///        table with huge pages (ignored if it can't)
+                ///
+                ////////////////////////////////////////////////////////////////
+                TranspositionTable(const std::size_t& size, const bool& useHugePages);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Class destructor
+                ///
+                ////////////////////////////////////////////////////////////////
+                ~TranspositionTable();
+
+
+                ////////////////////////////////////////////////////////////////
+                TranspositionTable(const TranspositionTable&) = delete;
+                TranspositionTable& operator=(const TranspositionTable&) = delete;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to remove every entry
+                ///
+                ////////////////////////////////////////////////////////////////
+                void clear();
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to be called before each search, so the
+                ///        entries of earlier searches are replaced first
+                ///
+                ////////////////////////////////////////////////////////////////
+                void newSearch() {generation = (generation + 1) & 0x3F;}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to find the entry of a position
+                ///
+                /// \param hash The Zobrist hash of the position
+                /// \param entry Set to the entry if it's found
+                ///
+                /// \return Whether the position has an entry
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool probe(const game::hash_t& hash, Entry& entry) const;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to store a search result
+                ///
+                /// \param hash The Zobrist hash of the position
+                /// \param value The value from the point of view of the player
+                ///        to move
+                /// \param depth The depth the position was searched to
+                /// \param bound The kind of value
+                /// \param move The bit index of the best move, or NO_MOVE
+                ///
+                ////////////////////////////////////////////////////////////////
+                void store(const game::hash_t& hash, const int32_t& value, const uint8_t& depth, const Bound& bound,
+                        const uint8_t& move);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the size of the table in bytes
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::size_t getSize() const {return numBuckets * sizeof(Bucket);}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to determine if the table was allocated for
+                ///        huge pages
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool isUsingHugePages() const {return hugePages;}
+
+        };
+
+    }
+
+}
+
+#endif //OTHELLO_AI_TRANSPOSITIONTABLE_HPP
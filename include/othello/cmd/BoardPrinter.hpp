@@ -26,13 +26,13 @@ namespace othello
                 ///
                 /// \param board A const reference to the othello board to print
                 /// \param player The number of the current player
-                /// \param possibleMoves A vector of possible moves. If the
-                ///        vector is empty, no possible moves are displayed. By
-                ///        default an empty vector
+                /// \param possibleMoves A list of possible moves. If the
+                ///        list is empty, no possible moves are displayed. By
+                ///        default an empty list
                 ///
                 ////////////////////////////////////////////////////////////////
                 static void print(const game::Board& board, const uint8_t& player,
-                        const std::vector<game::Move>& possibleMoves = {});
+                        const game::MoveList& possibleMoves = {});
                 
         };
         
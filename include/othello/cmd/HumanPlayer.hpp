@@ -29,7 +29,7 @@ namespace othello
                 ///        move. This function asks the user for a position in
                 ///        the command prompt
                 ///
-                /// \param possibleMoves A vector of the possible moves
+                /// \param possibleMoves A list of the possible moves
                 ///
                 /// \return A const pointer to a const move that will be played
                 ///         by the current player. This pointer must point to a
@@ -37,7 +37,7 @@ namespace othello
                 ///
                 ////////////////////////////////////////////////////////////////
                 const game::Move* makeMove(const game::Game&, const uint8_t&,
-                        const std::vector<game::Move>& possibleMoves) override
+                        const game::MoveList& possibleMoves) override
                 {
                     std::string input;
                     while (true)
@@ -58,8 +58,8 @@ namespace othello
                         for (const auto& move : possibleMoves)
                         {
                             //If it's a match
-                            if (move.diskPosition.x == x &&
-                                move.diskPosition.y == y)
+                            if (move.getDiskPosition().x == x &&
+                                move.getDiskPosition().y == y)
                             {
                                 //Return that move
                                 return &move;
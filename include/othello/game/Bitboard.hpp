@@ -0,0 +1,215 @@
+#ifndef OTHELLO_GAME_BITBOARD_HPP
+#define OTHELLO_GAME_BITBOARD_HPP
+
+//Standard C++:
+#include <cstdint>
+//Othello headers:
+#include <othello/game/Tile.hpp>
+
+
+//The size of the board can be changed at compile time (CMake option
+//OTHELLO_BOARD_SIZE)
+#ifndef OTHELLO_BOARD_SIZE
+#define OTHELLO_BOARD_SIZE 8
+#endif
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \brief Convenience typedef for a bitboard
+        ///
+        /// A bitboard is a 64 bit mask with one bit per tile. The tile at
+        /// (x, y) is stored in bit `y * 8 + x`, so bit 0 is the top-left
+        /// tile and bit 63 is the bottom-right tile
+        ///
+        /// Smaller boards use the top-left corner of the same layout, and
+        /// the other bits are never set (see bitboard::VALID_TILES), so the
+        /// same kernels work for every size
+        ///
+        ////////////////////////////////////////////////////////////////
+        typedef uint64_t bitboard_t;
+
+
+        namespace bitboard
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The number of tiles in a row of a bitboard
+            ///
+            ////////////////////////////////////////////////////////////////
+            static constexpr uint8_t ROW_SIZE = 8;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The number of tiles in a row of the board
+            ///
+            ////////////////////////////////////////////////////////////////
+            static constexpr uint8_t BOARD_SIZE = OTHELLO_BOARD_SIZE;
+
+
+            ////////////////////////////////////////////////////////////////
+            static_assert(BOARD_SIZE >= 4 && BOARD_SIZE <= ROW_SIZE, "The bitboard layout supports boards up to 8x8");
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to build the mask of the tiles that are on
+            ///        the board
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline constexpr bitboard_t makeValidTiles()
+            {
+                const bitboard_t row = (bitboard_t(1) << BOARD_SIZE) - 1;
+                bitboard_t tiles = 0;
+                for (uint8_t y = 0; y < BOARD_SIZE; ++y) {tiles |= row << (y * ROW_SIZE);}
+                return tiles;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The tiles that are on the board (every tile for 8x8)
+            ///
+            ////////////////////////////////////////////////////////////////
+            static constexpr bitboard_t VALID_TILES = makeValidTiles();
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to build the mask of a quadrant of the board
+            ///
+            /// \param q The quadrant, where bit 0 is set for the right half
+            ///        and bit 1 is set for the bottom half
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline constexpr bitboard_t makeQuadrant(const uint8_t& q)
+            {
+                const bitboard_t row = (bitboard_t(1) << (BOARD_SIZE / 2)) - 1;
+                bitboard_t quadrant = 0;
+                for (uint8_t y = 0; y < BOARD_SIZE / 2; ++y) {quadrant |= row << (y * ROW_SIZE);}
+                return quadrant << ((q & 1) * (BOARD_SIZE / 2) + (q >> 1) * (BOARD_SIZE / 2) * ROW_SIZE);
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the index of the bit that holds the
+            ///        given tile position
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline constexpr uint8_t toIndex(const TilePosition& pos)
+            {
+                return static_cast<uint8_t>(pos.y * ROW_SIZE + pos.x);
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the tile position of the given bit
+            ///        index
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline constexpr TilePosition toPosition(const uint8_t& index)
+            {
+                return {static_cast<uint8_t>(index % ROW_SIZE), static_cast<uint8_t>(index / ROW_SIZE)};
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the number of a tile when the tiles
+            ///        of the board are numbered row by row without gaps
+            ///        (from 0 to BOARD_SIZE * BOARD_SIZE - 1)
+            ///
+            /// Used for anything that stores one value per tile, like the
+            /// inputs of a neural network. The same as the index for 8x8
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline constexpr uint8_t toTileNumber(const uint8_t& index)
+            {
+                return static_cast<uint8_t>((index / ROW_SIZE) * BOARD_SIZE + index % ROW_SIZE);
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the index of the bit that holds the
+            ///        tile with the given number (see toTileNumber)
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline constexpr uint8_t fromTileNumber(const uint8_t& number)
+            {
+                return static_cast<uint8_t>((number / BOARD_SIZE) * ROW_SIZE + number % BOARD_SIZE);
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get a bitboard with only the given bit
+            ///        index set
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline constexpr bitboard_t toBit(const uint8_t& index) {return bitboard_t(1) << index;}
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the number of set bits (tiles) in a
+            ///        bitboard
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline uint8_t popCount(const bitboard_t& bb)
+            {
+                return static_cast<uint8_t>(__builtin_popcountll(bb));
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the index of the lowest set bit
+            ///
+            /// \warning The result is undefined if bb is 0
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline uint8_t lowestIndex(const bitboard_t& bb)
+            {
+                return static_cast<uint8_t>(__builtin_ctzll(bb));
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to remove the lowest set bit from a bitboard
+            ///        and return its index
+            ///
+            /// Used for iterating over the tiles in a bitboard:
+            /// `while (bb) {uint8_t i = bitboard::popLowest(bb); ...}`
+            ///
+            /// \warning The result is undefined if bb is 0
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline uint8_t popLowest(bitboard_t& bb)
+            {
+                const uint8_t index = lowestIndex(bb);
+                bb &= bb - 1;
+                return index;
+            }
+
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get every tile next to (including
+            ///        diagonally) a tile in a bitboard
+            ///
+            /// \return The neighbouring tiles, not including the tiles in bb
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline bitboard_t getNeighbours(const bitboard_t& bb)
+            {
+                //Spread the tiles left and right (without wrapping to the next
+                //row), then up and down
+                const bitboard_t row = bb | ((bb >> 1) & 0x7F7F7F7F7F7F7F7FULL) | ((bb << 1) & 0xFEFEFEFEFEFEFEFEULL);
+                return (row | (row << ROW_SIZE) | (row >> ROW_SIZE)) & ~bb;
+            }
+
+        }
+
+    }
+
+}
+
+#endif //OTHELLO_GAME_BITBOARD_HPP
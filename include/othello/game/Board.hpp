@@ -4,8 +4,13 @@
 //Standard C++:
 #include <cstdint>
 #include <array>
+#include <functional>
+#include <string>
+#include <type_traits>
 //Othello headers
-#include <othello/game/Move.hpp>
+#include <othello/game/MoveList.hpp>
+#include <othello/game/Bitboard.hpp>
+#include <othello/game/Zobrist.hpp>
 
 
 namespace othello
@@ -14,6 +19,41 @@ namespace othello
     namespace game
     {
     
+        ////////////////////////////////////////////////////////////////
+        /// \struct UndoRecord
+        ///
+        /// \brief Struct containing everything needed to take back a move
+        ///        with Board::undoMove
+        ///
+        ////////////////////////////////////////////////////////////////
+        struct UndoRecord
+        {
+            
+            ////////////////////////////////////////////////////////////////
+            /// \brief The move that was made (including the player that made
+            ///        it and the disks it flipped)
+            ///
+            ////////////////////////////////////////////////////////////////
+            Move move;
+            
+            
+            ////////////////////////////////////////////////////////////////
+            /// \brief The legal moves of the player that made the move,
+            ///        before it was made
+            ///
+            ////////////////////////////////////////////////////////////////
+            bitboard_t legalMoves;
+            
+            
+            ////////////////////////////////////////////////////////////////
+            /// \brief The hash of the position before the move was made
+            ///
+            ////////////////////////////////////////////////////////////////
+            hash_t hash;
+            
+        };
+        
+        
         ////////////////////////////////////////////////////////////////
         /// \class Board
         ///
@@ -28,7 +68,7 @@ namespace othello
                 /// \brief The size of a board
                 ///
                 ////////////////////////////////////////////////////////////////
-                static constexpr std::uint8_t BOARD_SIZE = 8;
+                static constexpr std::uint8_t BOARD_SIZE = bitboard::BOARD_SIZE;
         
         
                 ////////////////////////////////////////////////////////////////
@@ -38,10 +78,11 @@ namespace othello
             private:
         
                 ////////////////////////////////////////////////////////////////
-                /// \brief The game board
+                /// \brief The disks of each player, as one bitboard per player
+                ///        (disks[0] is player 1, disks[1] is player 2)
                 ///
                 ////////////////////////////////////////////////////////////////
-                Tile grid[BOARD_SIZE][BOARD_SIZE] = {};
+                std::array<bitboard_t, 2> disks = {};
         
                 
                 ////////////////////////////////////////////////////////////////
@@ -52,51 +93,128 @@ namespace othello
         
         
                 ////////////////////////////////////////////////////////////////
-                /// \brief A vector of the possible moves for each player
+                /// \brief The Zobrist hash of the disks and the current player
+                ///
+                /// Updated with a few XORs for every move instead of being
+                /// recalculated
                 ///
                 ////////////////////////////////////////////////////////////////
-                std::vector<Move> possibleMoves[2];
+                hash_t hash = 0;
         
         
                 ////////////////////////////////////////////////////////////////
-                /// \brief The current score
+                /// \brief A bitboard of the tiles the current player can place
+                ///        a disk on
+                ///
+                /// Always kept up to date, as it's needed to detect passes.
+                /// If it's empty after a pass, neither player can move and the
+                /// game is over
                 ///
                 ////////////////////////////////////////////////////////////////
-                std::pair<uint8_t, uint8_t> score = {2, 2};
-                
+                bitboard_t legalMoves = 0;
+        
+        
+            
                 
+            public:
+        
                 ////////////////////////////////////////////////////////////////
-                /// \brief Whether the game on the board is done
+                /// \brief Class constructor that initialises the board
                 ///
                 ////////////////////////////////////////////////////////////////
-                bool finished = false;
+                Board();
+        
         
-                
                 ////////////////////////////////////////////////////////////////
-                /// \brief Function to update possiblesMoves for the current
-                ///        state of the board
+                /// \brief Class constructor that sets up the given position
+                ///
+                /// If the given player can't move but the other player can,
+                /// the other player becomes the current player (they pass)
+                ///
+                /// \param disks The disks of each player. They mustn't overlap
+                /// \param currentPlayer The index of the player whose turn it
+                ///        is
                 ///
                 ////////////////////////////////////////////////////////////////
-                void calculatePossibleMoves(Move previousMove);
-            
-                
-            public:
+                Board(const std::array<bitboard_t, 2>& disks, const uint8_t& currentPlayer);
+        
         
                 ////////////////////////////////////////////////////////////////
-                /// \brief Class constructor that initialises the board
+                /// \brief Function to create a board from a string
+                ///
+                /// The string has a character for each tile, row by row from
+                /// the top-left: 'X' (player 1), 'O' (player 2) or '-'/'.'
+                /// (empty). Whitespace is ignored. It can be followed by 'X' or
+                /// 'O' for the player whose turn it is (player 1 if missing)
+                ///
+                /// \throws std::invalid_argument if the string isn't a valid
+                ///         position
                 ///
                 ////////////////////////////////////////////////////////////////
-                Board();
+                static Board fromString(const std::string& str);
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to write the board as a string that can be
+                ///        read by fromString
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::string toString() const;
                 
                 
                 ////////////////////////////////////////////////////////////////
-                /// \brief Const function to get a const reference to a tile at
-                ///        the given position
+                /// \brief Const function to get the tile at the given position
+                ///
+                /// \note Prefer the bitboard functions below when looking at
+                ///       more than a few tiles
                 ///
                 /// \warning Doesn't check if pos.x/pos.y is out of bounds
                 ///
                 ////////////////////////////////////////////////////////////////
-                const Tile& getTile(const TilePosition& pos) const;
+                Tile getTile(const TilePosition& pos) const;
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the disks of the given player
+                ///
+                /// \param player The index of the player (0 = player 1,
+                ///        1 = player 2)
+                ///
+                /// \return A bitboard with a bit set for every tile the player
+                ///         has a disk on
+                ///
+                ////////////////////////////////////////////////////////////////
+                bitboard_t getDisks(const uint8_t& player) const {return disks[player];}
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the disks of the player who's turn it
+                ///        currently is
+                ///
+                ////////////////////////////////////////////////////////////////
+                bitboard_t getPlayerDisks() const {return disks[currentPlayer];}
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the disks of the player who's turn it
+                ///        currently isn't
+                ///
+                ////////////////////////////////////////////////////////////////
+                bitboard_t getOpponentDisks() const {return disks[!currentPlayer];}
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the tiles that have a disk on them
+                ///
+                ////////////////////////////////////////////////////////////////
+                bitboard_t getOccupiedTiles() const {return disks[0] | disks[1];}
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the tiles without a disk on them
+                ///
+                ////////////////////////////////////////////////////////////////
+                bitboard_t getEmptyTiles() const {return ~getOccupiedTiles() & bitboard::VALID_TILES;}
         
         
                 ////////////////////////////////////////////////////////////////
@@ -113,12 +231,47 @@ namespace othello
                 /// \brief Function to get the possible moves for the current
                 ///        player
                 ///
-                /// \return A const reference to the possible moves for this
-                ///         player. The vector this points to will change every
-                ///         time it's the current player's turn
+                /// The list isn't kept in the board (so boards stay small and
+                /// cheap to copy), every call builds it again
+                ///
+                /// \param possibleMoves The output, the possible moves for this
+                ///        player (in the order of the tiles on the board)
                 ///
                 ////////////////////////////////////////////////////////////////
-                const std::vector<Move>& getPossibleMoves() const;
+                void getPossibleMoves(MoveList& possibleMoves) const;
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to determine if the current player can
+                ///        place a disk anywhere
+                ///
+                /// Only tests the legal move bitboard, no move list is built
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool hasLegalMove() const;
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the possible moves for the current
+                ///        player as a bitboard
+                ///
+                /// Cheaper than getPossibleMoves, as no flipped disks are
+                /// calculated (and the bitboard is already known). Moves can be
+                /// made from the tiles with createMove
+                ///
+                ////////////////////////////////////////////////////////////////
+                bitboard_t getLegalMoves() const;
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to create the current player's move for
+                ///        placing a disk on the given tile
+                ///
+                /// \param square The bit index of the tile. Must be set in
+                ///        getLegalMoves
+                ///
+                ////////////////////////////////////////////////////////////////
+                Move createMove(const uint8_t& square) const;
         
         
                 ////////////////////////////////////////////////////////////////
@@ -129,32 +282,133 @@ namespace othello
                 /// \note The board is not automatically reset after a game ends
                 ///
                 /// \param move A const pointer to a const move that will be
-                ///        played by the current player. This pointer must point
-                ///        to a move in getPossibleMoves
+                ///        played by the current player. It must be one of the
+                ///        moves from getPossibleMoves
+                ///
+                /// \throws std::invalid_argument if the move isn't one of the
+                ///         current player's possible moves
+                ///
+                /// \return A record that can be given to undoMove to take the
+                ///         move back. Use isOver to find out if the move ended
+                ///         the game
+                ///
+                ////////////////////////////////////////////////////////////////
+                UndoRecord makeMove(const Move* move);
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to play the next turn without checking the
+                ///        move
+                ///
+                /// Used by searches that walk the game tree on a single board
+                /// with applyMove/undoMove instead of copying it. Use makeMove
+                /// for moves that haven't come from this board
+                ///
+                /// \param move A move for the current player, either from
+                ///        getPossibleMoves or createMove
+                ///
+                /// \return A record that can be given to undoMove to take the
+                ///         move back
+                ///
+                ////////////////////////////////////////////////////////////////
+                UndoRecord applyMove(const Move& move);
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to take back the last move made on the board
+                ///
+                /// Restores the disks, the current player and their legal moves
+                /// in O(1). Moves must be undone in the reverse
+                /// order they were made
                 ///
-                /// \return Whether this move ended the game
+                /// \param undo The record returned by makeMove or applyMove
                 ///
                 ////////////////////////////////////////////////////////////////
-                bool makeMove(const Move* move);
+                void undoMove(const UndoRecord& undo);
         
                 
                 ////////////////////////////////////////////////////////////////
                 /// \brief Function to get the board's current score (number of
                 ///        disks for each player)
                 ///
-                /// \return A const reference pair where the first value is
-                ///         player 1's score and the second is player 2's score
+                /// \return A pair where the first value is player 1's score and
+                ///         the second is player 2's score
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::pair<uint8_t, uint8_t> getScore() const;
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the Zobrist hash of the position
+                ///
+                /// Two boards with the same disks and the same current player
+                /// always have the same hash
+                ///
+                ////////////////////////////////////////////////////////////////
+                const hash_t& getHash() const;
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to determine if two boards hold the same
+                ///        position (the same disks and current player)
                 ///
                 ////////////////////////////////////////////////////////////////
-                const std::pair<uint8_t, uint8_t>& getScore() const;
+                bool operator==(const Board& other) const;
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to determine if two boards hold different
+                ///        positions
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool operator!=(const Board& other) const;
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get a copy of the board with a symmetry
+                ///        applied to it
+                ///
+                /// \param s The symmetry to apply (see symmetry)
+                ///
+                ////////////////////////////////////////////////////////////////
+                Board transform(const uint8_t& s) const;
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the canonical form of the position
+                ///
+                /// The canonical form is the symmetry of the board with the
+                /// lowest disks (player 1's disks first, then player 2's), so
+                /// all 8 symmetries of a position have the same canonical form
+                /// (and hash)
+                ///
+                /// \return A pair where the first value is the canonical board
+                ///         and the second is the symmetry that transforms this
+                ///         board into it. Moves in the canonical board can be
+                ///         mapped back with symmetry::inverse
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::pair<Board, uint8_t> getCanonical() const;
         
         
                 ////////////////////////////////////////////////////////////////
                 /// \brief Function to determine if the game on the board is
                 ///        over
                 ///
+                /// Same as isTerminal
+                ///
                 ////////////////////////////////////////////////////////////////
                 bool isOver() const;
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to determine if neither player can move
+                ///
+                /// Passes are resolved when a move is made, so this is a single
+                /// test of the legal move bitboard
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool isTerminal() const;
                 
                 
                 ////////////////////////////////////////////////////////////////
@@ -162,11 +416,46 @@ namespace othello
                 ///
                 ////////////////////////////////////////////////////////////////
                 void reset();
+        
+        
+            private:
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to set the disks and the current player,
+                ///        and recalculate everything that depends on them
+                ///
+                ////////////////////////////////////////////////////////////////
+                void setPosition(const std::array<bitboard_t, 2>& newDisks, const uint8_t& player);
             
         };
         
+        
+        ////////////////////////////////////////////////////////////////
+        static_assert(std::is_trivially_copyable<Board>::value && sizeof(Board) <= 5 * sizeof(bitboard_t),
+                      "Boards are copied by value all through the search, so they must stay small");
+        
     }
     
 }
 
+
+namespace std
+{
+    
+    ////////////////////////////////////////////////////////////////
+    /// \brief Hash specialization so boards can be used as keys in
+    ///        unordered containers
+    ///
+    ////////////////////////////////////////////////////////////////
+    template<>
+    struct hash<othello::game::Board>
+    {
+        std::size_t operator()(const othello::game::Board& board) const
+        {
+            return static_cast<std::size_t>(board.getHash());
+        }
+    };
+    
+}
+
 #endif //OTHELLO_GAME_BOARD_HPP
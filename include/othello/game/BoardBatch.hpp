@@ -0,0 +1,189 @@
+#ifndef OTHELLO_GAME_BOARDBATCH_HPP
+#define OTHELLO_GAME_BOARDBATCH_HPP
+
+//Standard C++:
+#include <cstdint>
+#include <vector>
+//Othello headers:
+#include <othello/game/Board.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \class BoardBatch
+        ///
+        /// \brief Class storing many positions as a structure of arrays,
+        ///        so kernels can work on several boards per instruction
+        ///
+        /// Each board is stored as the disks of the player to move, the
+        /// disks of their opponent, their legal moves and the index of
+        /// the player to move. Like Board, passes are resolved when moves
+        /// are made, so a board with no legal moves is a finished game
+        ///
+        /// The legal moves are calculated for 8 boards at once with
+        /// AVX-512 or 4 boards at once with AVX2, if the CPU supports
+        /// them (see util::CpuFeatures), and one at a time otherwise
+        ///
+        ////////////////////////////////////////////////////////////////
+        class BoardBatch
+        {
+            private:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The disks of the player to move on each board
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::vector<bitboard_t> playerDisks;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The disks of the other player on each board
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::vector<bitboard_t> opponentDisks;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The legal moves of the player to move on each board
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::vector<bitboard_t> legalMoves;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The index of the player to move on each board
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::vector<uint8_t> currentPlayers;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to recalculate the legal moves of the boards
+                ///        from the given index onwards, and pass on the boards
+                ///        where the player to move can't move
+                ///
+                ////////////////////////////////////////////////////////////////
+                void calculateLegalMoves(const std::size_t& first);
+
+
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the number of boards the kernels work
+                ///        on at once, with the enabled CPU features
+                ///
+                ////////////////////////////////////////////////////////////////
+                static std::size_t getVectorWidth();
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to add a board to the end of the batch
+                ///
+                ////////////////////////////////////////////////////////////////
+                void add(const Board& board);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to add a board for every possible move of
+                ///        the given board, in the order of the tiles
+                ///
+                /// Used to expand a node of a search all at once
+                ///
+                /// \return The number of boards added
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::size_t addChildren(const Board& board);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to remove all the boards from the batch
+                ///
+                /// \note Keeps the memory, so a batch can be reused without
+                ///       allocating
+                ///
+                ////////////////////////////////////////////////////////////////
+                void clear();
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the number of boards in the batch
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::size_t size() const;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to determine if the batch has no boards
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool empty() const;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to copy a board out of the batch
+                ///
+                ////////////////////////////////////////////////////////////////
+                Board getBoard(const std::size_t& i) const;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the legal moves of every board (one
+                ///        bitboard per board)
+                ///
+                ////////////////////////////////////////////////////////////////
+                const bitboard_t* getLegalMoves() const;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the index of the player to move on
+                ///        every board
+                ///
+                ////////////////////////////////////////////////////////////////
+                const uint8_t* getCurrentPlayers() const;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to make one move on every board
+                ///
+                /// \param squares The bit index of the tile to place a disk on
+                ///        for each board. Each must be a legal move of its
+                ///        board, and finished boards mustn't be in the batch
+                ///
+                /// \throws std::invalid_argument if a square isn't a legal
+                ///         move of its board (no board is changed)
+                ///
+                ////////////////////////////////////////////////////////////////
+                void makeMoves(const uint8_t* squares);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to score every board by weighted disk
+                ///        counts
+                ///
+                /// The score of a board is the sum of `weights[g]` times the
+                /// number of the player's disks in `masks[g]`, minus the same
+                /// for the other player's disks
+                ///
+                /// \param player The index of the player to score the boards
+                ///        for
+                /// \param masks The tiles in each weight group
+                /// \param weights The weight of each group
+                /// \param numGroups The number of weight groups
+                /// \param scores The output, one score per board
+                ///
+                ////////////////////////////////////////////////////////////////
+                void getWeightedDiskCounts(const uint8_t& player, const bitboard_t* masks, const int64_t* weights,
+                        const std::size_t& numGroups, int64_t* scores) const;
+
+        };
+
+    }
+
+}
+
+#endif //OTHELLO_GAME_BOARDBATCH_HPP
@@ -4,6 +4,7 @@
 //Standard C++:
 #include <cstdint>
 #include <array>
+#include <vector>
 #include <memory>
 #include <functional>
 //Boost headers:
@@ -78,6 +79,22 @@ namespace othello
                 bool playersAreSwitched = false;
         
         
+                ////////////////////////////////////////////////////////////////
+                /// \brief The player that finishes games for both players
+                ///        (nullptr if there isn't one)
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::shared_ptr<IPlayer> adjudicator = nullptr;
+        
+        
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of empty tiles at which the adjudicator
+                ///        takes over
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint8_t adjudicationEmpties = 0;
+        
+        
                 ////////////////////////////////////////////////////////////////
                 /// \brief An optional that possibly contains a statistics
                 ///        manager
@@ -143,6 +160,22 @@ namespace othello
                 void manualSwitchPlayers();
         
         
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to set a player that makes the moves of both
+                ///        players once few tiles are left
+                ///
+                /// The players' results then only depend on their moves until
+                /// the adjudicator takes over
+                ///
+                /// \param adjudicator A shared pointer to the player, or
+                ///        nullptr to let the players finish their games
+                /// \param empties The number of empty tiles at which the
+                ///        adjudicator takes over
+                ///
+                ////////////////////////////////////////////////////////////////
+                void setAdjudicator(const std::shared_ptr<IPlayer>& adjudicator, const uint8_t& empties);
+        
+        
                 ////////////////////////////////////////////////////////////////
                 /// \brief Function to set the game board
                 ///
@@ -183,11 +216,11 @@ namespace othello
                 /// \brief Function to get the board's current score (number of
                 ///        disks for each player)
                 ///
-                /// \return A const reference pair where the first value is
-                ///         player 1's score and the second is player 2's score
+                /// \return A pair where the first value is player 1's score and
+                ///         the second is player 2's score
                 ///
                 ////////////////////////////////////////////////////////////////
-                const std::pair<uint8_t, uint8_t>& getScore() const;
+                std::pair<uint8_t, uint8_t> getScore() const;
         
         
                 ////////////////////////////////////////////////////////////////
@@ -1,10 +1,8 @@
 #ifndef OTHELLO_GAME_IPLAYER_HPP
 #define OTHELLO_GAME_IPLAYER_HPP
 
-//Standard C++:
-#include <vector>
 //Othello headers:
-#include <othello/game/Move.hpp>
+#include <othello/game/MoveList.hpp>
 
 
 namespace othello
@@ -41,7 +39,7 @@ namespace othello
                 /// \param game A const reference to the game to make a move in
                 /// \param player The index of this player in the game. (0 is
                 ///        player 1, 1 is player 2)
-                /// \param possibleMoves A vector of the possible moves
+                /// \param possibleMoves A list of the possible moves
                 ///
                 /// \return A const pointer to a const move that will be played
                 ///         by the current player. This pointer must point to a
@@ -49,7 +47,7 @@ namespace othello
                 ///
                 ////////////////////////////////////////////////////////////////
                 virtual const Move* makeMove(const game::Game& game, const uint8_t& player,
-                        const std::vector<Move>& possibleMoves) = 0;
+                        const MoveList& possibleMoves) = 0;
         
         
                 ////////////////////////////////////////////////////////////////
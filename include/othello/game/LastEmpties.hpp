@@ -0,0 +1,83 @@
+#ifndef OTHELLO_GAME_LASTEMPTIES_HPP
+#define OTHELLO_GAME_LASTEMPTIES_HPP
+
+//Standard C++:
+#include <cstdint>
+//Othello headers:
+#include <othello/game/Board.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \class LastEmpties
+        ///
+        /// \brief Static class for solving positions with only a few
+        ///        empty tiles left
+        ///
+        /// The last plies are most of the positions of any search to the
+        /// end of the game, so they're searched without a Board or a move
+        /// list: the disks are passed by value, the empty tiles are
+        /// passed down as an array with the tile being played removed,
+        /// and the number of empty tiles is a template parameter so the
+        /// loops are unrolled. The last move isn't made at all, its
+        /// flipped disks are only counted
+        ///
+        /// Scores are the final disk difference from the point of view of
+        /// the player to move, like ai::EndgameSolver
+        ///
+        ////////////////////////////////////////////////////////////////
+        class LastEmpties
+        {
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The most empty tiles a position can have to be
+                ///        solved
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint8_t MAX_EMPTIES = 4;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to count the disks that would be flipped by
+                ///        placing a disk on the given tile, without placing it
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint8_t countFlips(const bitboard_t& player, const bitboard_t& opponent, const uint8_t& index);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to solve a position with at most
+                ///        MAX_EMPTIES empty tiles
+                ///
+                /// The tiles in quadrants with an odd number of empty tiles
+                /// are tried first
+                ///
+                /// \param player The disks of the player to move
+                /// \param opponent The disks of the other player
+                /// \param nodes The number of positions searched, which is
+                ///        added to
+                ///
+                /// \return The final disk difference from the point of view of
+                ///         the player to move (fail-soft, so a bound if it's
+                ///         outside the window)
+                ///
+                /// \throws std::invalid_argument if there are too many empty
+                ///         tiles
+                ///
+                ////////////////////////////////////////////////////////////////
+                static int solve(const bitboard_t& player, const bitboard_t& opponent, const int& alpha, const int& beta,
+                        uint64_t& nodes);
+
+        };
+
+    }
+
+}
+
+#endif //OTHELLO_GAME_LASTEMPTIES_HPP
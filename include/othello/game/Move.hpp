@@ -1,10 +1,9 @@
 #ifndef OTHELLO_GAME_MOVE_HPP
 #define OTHELLO_GAME_MOVE_HPP
 
-//Standard C++:
-#include <vector>
 //Othello headers:
 #include <othello/game/Tile.hpp>
+#include <othello/game/Bitboard.hpp>
 
 namespace othello
 {
@@ -17,6 +16,9 @@ namespace othello
         ///
         /// \brief Class storing a "move" in a game of Othello
         ///
+        /// A move is a plain 16 byte value (no heap memory), so lists of
+        /// moves can be stored inline and copied freely
+        ///
         ////////////////////////////////////////////////////////////////
         class Move
         {
@@ -27,37 +29,53 @@ namespace othello
                 /// \brief Class constructor
                 ///
                 ////////////////////////////////////////////////////////////////
-                Move(uint8_t p, const TilePosition& d,
-                        std::vector<TilePosition> f = {})
-                        : player(p), diskPosition(d),
-                        flippedDiskPositions(std::move(f)) {}
+                Move(uint8_t p, uint8_t s, bitboard_t f)
+                        : flips(f), square(s), player(p) {}
                         
                     
             public:
                 
                 ////////////////////////////////////////////////////////////////
-                /// \brief The index of the player that did the move
+                /// \brief Default class constructor
                 ///
-                /// player == 0 is player 1, player == 2 is player 2
+                /// \note Only exists so moves can be stored in arrays. A
+                ///       default constructed move can't be made
                 ///
                 ////////////////////////////////////////////////////////////////
-                uint8_t player;
+                Move() = default;
                 
                 
                 ////////////////////////////////////////////////////////////////
-                /// \brief A const reference to the tile where the disk is being
+                /// \brief A bitboard of the disks that will be flipped over by
+                ///        this move
+                ///
+                ////////////////////////////////////////////////////////////////
+                bitboard_t flips;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The bit index of the tile where the disk is being
                 ///        placed
                 ///
                 ////////////////////////////////////////////////////////////////
-                TilePosition diskPosition;
-        
-        
+                uint8_t square;
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The index of the player that did the move
+                ///
+                /// player == 0 is player 1, player == 2 is player 2
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint8_t player;
+                
+                
                 ////////////////////////////////////////////////////////////////
-                /// \brief A vector of const references to tiles with disks that
-                ///        will be flipped over by this move
+                /// \brief Function to get the position of the tile where the
+                ///        disk is being placed
                 ///
                 ////////////////////////////////////////////////////////////////
-                std::vector<TilePosition> flippedDiskPositions;
+                TilePosition getDiskPosition() const {return bitboard::toPosition(square);}
             
         };
         
@@ -0,0 +1,116 @@
+#ifndef OTHELLO_GAME_MOVEGENERATOR_HPP
+#define OTHELLO_GAME_MOVEGENERATOR_HPP
+
+//Othello headers:
+#include <othello/game/Bitboard.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \class MoveGenerator
+        ///
+        /// \brief Static class for generating moves from a pair of
+        ///        bitboards
+        ///
+        /// Legal moves are found for all tiles at once with a
+        /// Kogge-Stone (parallel prefix) flood fill from the player's
+        /// disks through the opponent's disks in each of the 8
+        /// directions. If the CPU supports AVX2, four directions are
+        /// filled at once in one vector
+        ///
+        /// Flipped disks are only calculated for a single move, when it
+        /// is made. Each of the 4 lines through the tile is reduced to 8
+        /// bits per player and the flips are looked up in precomputed
+        /// outflank/flipped tables. If the CPU supports BMI2, PEXT and
+        /// PDEP are used to extract and deposit the lines
+        ///
+        /// Every version is compiled, and the one to use is picked on
+        /// each call from the enabled util::CpuFeatures
+        ///
+        ////////////////////////////////////////////////////////////////
+        class MoveGenerator
+        {
+            private:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to calculate the legal moves using only
+                ///        64 bit integer operations
+                ///
+                ////////////////////////////////////////////////////////////////
+                static bitboard_t getLegalMovesScalar(const bitboard_t& player, const bitboard_t& opponent);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to calculate the legal moves using AVX2,
+                ///        filling four directions per vector
+                ///
+                /// \note Only available on x86, and only run if the CPU supports
+                ///       AVX2
+                ///
+                ////////////////////////////////////////////////////////////////
+                static bitboard_t getLegalMovesAVX2(const bitboard_t& player, const bitboard_t& opponent);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to calculate the flipped disks by extracting
+                ///        the lines with shifts and multiplications
+                ///
+                ////////////////////////////////////////////////////////////////
+                static bitboard_t getFlipsTables(const bitboard_t& player, const bitboard_t& opponent,
+                        const uint8_t& index);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to calculate the flipped disks by extracting
+                ///        the lines with PEXT and PDEP
+                ///
+                /// \note Only available on x86, and only run if the CPU supports
+                ///       BMI2
+                ///
+                ////////////////////////////////////////////////////////////////
+                static bitboard_t getFlipsBMI2(const bitboard_t& player, const bitboard_t& opponent,
+                        const uint8_t& index);
+
+
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to calculate every legal move of a player
+                ///
+                /// \param player The disks of the player who is moving
+                /// \param opponent The disks of the other player
+                ///
+                /// \return A bitboard with a bit set for every tile the player
+                ///         can place a disk on
+                ///
+                ////////////////////////////////////////////////////////////////
+                static bitboard_t getLegalMoves(const bitboard_t& player, const bitboard_t& opponent);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to calculate the disks that would be flipped
+                ///        by placing a disk on the given tile
+                ///
+                /// \param player The disks of the player who is moving
+                /// \param opponent The disks of the other player
+                /// \param index The bit index of the tile the disk is placed on
+                ///
+                /// \return A bitboard of the opponent's disks that would be
+                ///         flipped. 0 if the move isn't legal
+                ///
+                ////////////////////////////////////////////////////////////////
+                static bitboard_t getFlips(const bitboard_t& player, const bitboard_t& opponent,
+                        const uint8_t& index);
+
+        };
+
+    }
+
+}
+
+#endif //OTHELLO_GAME_MOVEGENERATOR_HPP
@@ -0,0 +1,147 @@
+#ifndef OTHELLO_GAME_MOVELIST_HPP
+#define OTHELLO_GAME_MOVELIST_HPP
+
+//Standard C++:
+#include <array>
+#include <stdexcept>
+//Othello headers:
+#include <othello/game/Move.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \class MoveList
+        ///
+        /// \brief Fixed capacity list of moves that is stored inline
+        ///
+        /// A position can never have more legal moves than empty tiles,
+        /// so the moves are kept in an array of that size and the list
+        /// never allocates. It is trivially copyable
+        ///
+        ////////////////////////////////////////////////////////////////
+        class MoveList
+        {
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The maximum number of moves in a list (every tile but
+                ///        the 4 starting tiles)
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr uint8_t MAX_MOVES = bitboard::BOARD_SIZE * bitboard::BOARD_SIZE - 4;
+
+
+            private:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The moves
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::array<Move, MAX_MOVES> moves;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The number of moves in the list
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint8_t count = 0;
+
+
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to add a move to the end of the list
+                ///
+                /// \warning Doesn't check if the list is full
+                ///
+                ////////////////////////////////////////////////////////////////
+                void push_back(const Move& move) {moves[count++] = move;}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to remove all the moves from the list
+                ///
+                ////////////////////////////////////////////////////////////////
+                void clear() {count = 0;}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the number of moves in the list
+                ///
+                ////////////////////////////////////////////////////////////////
+                std::size_t size() const {return count;}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to determine if the list has no moves
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool empty() const {return count == 0;}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get a move without bounds checking
+                ///
+                ////////////////////////////////////////////////////////////////
+                const Move& operator[](const std::size_t& i) const {return moves[i];}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get a move without bounds checking
+                ///
+                ////////////////////////////////////////////////////////////////
+                Move& operator[](const std::size_t& i) {return moves[i];}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get a move
+                ///
+                /// \throws std::out_of_range if i isn't less than size()
+                ///
+                ////////////////////////////////////////////////////////////////
+                const Move& at(const std::size_t& i) const
+                {
+                    if (i >= count) {throw std::out_of_range("MoveList index out of range");}
+                    return moves[i];
+                }
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get a pointer to the first move
+                ///
+                ////////////////////////////////////////////////////////////////
+                const Move* begin() const {return moves.data();}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get a pointer past the last move
+                ///
+                ////////////////////////////////////////////////////////////////
+                const Move* end() const {return moves.data() + count;}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get a pointer to the first move
+                ///
+                ////////////////////////////////////////////////////////////////
+                Move* begin() {return moves.data();}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get a pointer past the last move
+                ///
+                ////////////////////////////////////////////////////////////////
+                Move* end() {return moves.data() + count;}
+
+        };
+
+    }
+
+}
+
+#endif //OTHELLO_GAME_MOVELIST_HPP
@@ -0,0 +1,77 @@
+#ifndef OTHELLO_GAME_PERFT_HPP
+#define OTHELLO_GAME_PERFT_HPP
+
+//Standard C++:
+#include <cstdint>
+#include <vector>
+#include <utility>
+//Othello headers:
+#include <othello/game/Board.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \class Perft
+        ///
+        /// \brief Static class for counting the positions at a given
+        ///        depth of the game tree (performance test)
+        ///
+        /// Used to check the move generator against known counts and to
+        /// measure its speed. A pass counts as a move, and a finished
+        /// game counts as one leaf however deep it is
+        ///
+        /// The root moves can be split between threads, and each thread
+        /// can keep a hash table of subtree counts so transpositions are
+        /// only counted once
+        ///
+        ////////////////////////////////////////////////////////////////
+        class Perft
+        {
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to count the leaves below each of the
+                ///        current player's moves
+                ///
+                /// \param board The position to count from
+                /// \param depth The number of moves to look ahead
+                /// \param numThreads The number of threads to split the root
+                ///        moves between
+                /// \param hashSize The size of the hash table of each thread
+                ///        in bytes. 0 disables hashing
+                ///
+                /// \return A vector of the square of each root move (in
+                ///         order) and its number of leaves. Empty if the game
+                ///         is over or depth is 0
+                ///
+                ////////////////////////////////////////////////////////////////
+                static std::vector<std::pair<uint8_t, uint64_t> > divide(const Board& board, const uint8_t& depth,
+                        const unsigned int& numThreads = 1, const std::size_t& hashSize = 0);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to count the leaves of the game tree
+                ///
+                /// \param board The position to count from
+                /// \param depth The number of moves to look ahead
+                /// \param numThreads The number of threads to split the root
+                ///        moves between
+                /// \param hashSize The size of the hash table of each thread
+                ///        in bytes. 0 disables hashing
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint64_t count(const Board& board, const uint8_t& depth,
+                        const unsigned int& numThreads = 1, const std::size_t& hashSize = 0);
+
+        };
+
+    }
+
+}
+
+#endif //OTHELLO_GAME_PERFT_HPP
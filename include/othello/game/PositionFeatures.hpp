@@ -0,0 +1,125 @@
+#ifndef OTHELLO_GAME_POSITIONFEATURES_HPP
+#define OTHELLO_GAME_POSITIONFEATURES_HPP
+
+//Othello headers:
+#include <othello/game/Board.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \class PositionFeatures
+        ///
+        /// \brief Static class for calculating features of a position
+        ///        that evaluators can use
+        ///
+        /// Every feature is calculated from the bitboards with a few
+        /// shifts, masks and population counts, so they're cheap enough
+        /// to be used at every leaf of a search
+        ///
+        ////////////////////////////////////////////////////////////////
+        class PositionFeatures
+        {
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \struct Features
+                ///
+                /// \brief Struct containing all the features of a position.
+                ///        The arrays are indexed by player
+                ///
+                ////////////////////////////////////////////////////////////////
+                struct Features
+                {
+                    uint8_t mobility[2];
+                    uint8_t frontier[2];
+                    uint8_t potentialMobility[2];
+                    uint8_t stable[2];
+                    uint8_t parity;
+                    uint8_t numEmpty;
+                };
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The quadrants of the board, in the order of the bits
+                ///        of getParity (top-left, top-right, bottom-left and
+                ///        bottom-right)
+                ///
+                ////////////////////////////////////////////////////////////////
+                static constexpr bitboard_t QUADRANTS[4] =
+                        {bitboard::makeQuadrant(0), bitboard::makeQuadrant(1),
+                         bitboard::makeQuadrant(2), bitboard::makeQuadrant(3)};
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the number of moves a player can
+                ///        make
+                ///
+                /// Free for the current player, as the board already knows
+                /// their moves
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint8_t getMobility(const Board& board, const uint8_t& player);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the number of a player's disks that
+                ///        are next to an empty tile
+                ///
+                /// Frontier disks are usually a weakness, as they give the
+                /// other player moves
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint8_t getFrontier(const Board& board, const uint8_t& player);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the number of empty tiles next to
+                ///        the other player's disks
+                ///
+                /// An estimate of the moves the player could have in the
+                /// future
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint8_t getPotentialMobility(const Board& board, const uint8_t& player);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get which quadrants of the board have
+                ///        an odd number of empty tiles
+                ///
+                /// \return A bit per quadrant (see QUADRANTS), set if the
+                ///         quadrant has an odd number of empty tiles
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint8_t getParity(const Board& board);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the number of a player's disks that
+                ///        can never be flipped (see Stability)
+                ///
+                /// A lower bound, and the most expensive feature, though still
+                /// only a few table lookups and shifts
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint8_t getStability(const Board& board, const uint8_t& player);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to calculate every feature at once
+                ///
+                ////////////////////////////////////////////////////////////////
+                static Features getFeatures(const Board& board);
+
+        };
+
+    }
+
+}
+
+#endif //OTHELLO_GAME_POSITIONFEATURES_HPP
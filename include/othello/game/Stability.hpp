@@ -0,0 +1,85 @@
+#ifndef OTHELLO_GAME_STABILITY_HPP
+#define OTHELLO_GAME_STABILITY_HPP
+
+//Othello headers:
+#include <othello/game/Board.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \class Stability
+        ///
+        /// \brief Static class for finding disks that can never be
+        ///        flipped for the rest of the game
+        ///
+        /// The result is a lower bound, not every stable disk:
+        /// - Disks on the edges are found exactly, with a table of every
+        ///   edge configuration (3^8 entries), as an edge disk can only be
+        ///   flipped along its edge
+        /// - Other disks are stable if every line through them (row,
+        ///   column and both diagonals) is full, or is blocked by a stable
+        ///   disk of the same player next to them. This is repeated until
+        ///   no more stable disks are found
+        ///
+        /// A player's stable disks are theirs at the end of the game, so
+        /// they bound the final score, which lets searches that score
+        /// positions by disk count stop early
+        ///
+        ////////////////////////////////////////////////////////////////
+        class Stability
+        {
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get a player's stable disks
+                ///
+                /// \param player The disks of the player
+                /// \param opponent The disks of the other player
+                ///
+                /// \return A bitboard of disks that can never be flipped
+                ///
+                ////////////////////////////////////////////////////////////////
+                static bitboard_t getStableDisks(const bitboard_t& player, const bitboard_t& opponent);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the number of a player's stable disks
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint8_t getStableDiskCount(const Board& board, const uint8_t& player);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the lowest final score a player can
+                ///        get from a position (their disks minus the other
+                ///        player's disks), as the player keeps their stable
+                ///        disks
+                ///
+                ////////////////////////////////////////////////////////////////
+                static int getScoreLowerBound(const Board& board, const uint8_t& player);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the highest final score a player can
+                ///        get from a position (their disks minus the other
+                ///        player's disks), as the other player keeps their
+                ///        stable disks
+                ///
+                /// If this isn't more than alpha, a search can return without
+                /// searching the position's moves
+                ///
+                ////////////////////////////////////////////////////////////////
+                static int getScoreUpperBound(const Board& board, const uint8_t& player);
+
+        };
+
+    }
+
+}
+
+#endif //OTHELLO_GAME_STABILITY_HPP
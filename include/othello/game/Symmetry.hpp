@@ -0,0 +1,156 @@
+#ifndef OTHELLO_GAME_SYMMETRY_HPP
+#define OTHELLO_GAME_SYMMETRY_HPP
+
+//Othello headers:
+#include <othello/game/Bitboard.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \brief Functions for the 8 symmetries of the board (the
+        ///        rotations and reflections of a square)
+        ///
+        /// A symmetry is stored as a number from 0 to 7. Bit 0 mirrors
+        /// the board horizontally, bit 1 flips it vertically and bit 2
+        /// transposes it (swaps x and y), applied in that order. 0 is the
+        /// identity
+        ///
+        /// Boards smaller than 8x8 are in the top-left corner of the
+        /// bitboard, so after mirroring or flipping they're moved back
+        /// there
+        ///
+        ////////////////////////////////////////////////////////////////
+        namespace symmetry
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The number of symmetries
+            ///
+            ////////////////////////////////////////////////////////////////
+            static constexpr uint8_t NUM_SYMMETRIES = 8;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The symmetry that mirrors the board horizontally
+            ///        (x becomes 7 - x)
+            ///
+            ////////////////////////////////////////////////////////////////
+            static constexpr uint8_t MIRROR_HORIZONTAL = 1;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The symmetry that flips the board vertically (y
+            ///        becomes 7 - y)
+            ///
+            ////////////////////////////////////////////////////////////////
+            static constexpr uint8_t FLIP_VERTICAL = 2;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The symmetry that transposes the board (swaps x and
+            ///        y)
+            ///
+            ////////////////////////////////////////////////////////////////
+            static constexpr uint8_t TRANSPOSE = 4;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to mirror a bitboard horizontally
+            ///
+            /// Reverses the bits in every row with three swaps
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline bitboard_t mirrorHorizontal(bitboard_t bb)
+            {
+                bb = ((bb >> 1) & 0x5555555555555555ULL) | ((bb & 0x5555555555555555ULL) << 1);
+                bb = ((bb >> 2) & 0x3333333333333333ULL) | ((bb & 0x3333333333333333ULL) << 2);
+                bb = ((bb >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((bb & 0x0F0F0F0F0F0F0F0FULL) << 4);
+                return bb;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to flip a bitboard vertically
+            ///
+            /// Each row is a byte, so this is a byte swap
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline bitboard_t flipVertical(const bitboard_t& bb) {return __builtin_bswap64(bb);}
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to transpose a bitboard (mirror it along
+            ///        the top-left to bottom-right diagonal)
+            ///
+            /// Swaps the 4x4, 2x2 and 1x1 blocks either side of the
+            /// diagonal with delta swaps
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline bitboard_t transpose(bitboard_t bb)
+            {
+                bitboard_t t = 0x0F0F0F0F00000000ULL & (bb ^ (bb << 28));
+                bb ^= t ^ (t >> 28);
+                t = 0x3333000033330000ULL & (bb ^ (bb << 14));
+                bb ^= t ^ (t >> 14);
+                t = 0x5500550055005500ULL & (bb ^ (bb << 7));
+                bb ^= t ^ (t >> 7);
+                return bb;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to apply a symmetry to a bitboard
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline bitboard_t transform(bitboard_t bb, const uint8_t& s)
+            {
+                constexpr uint8_t unusedColumns = bitboard::ROW_SIZE - bitboard::BOARD_SIZE;
+                if (s & MIRROR_HORIZONTAL) {bb = mirrorHorizontal(bb) >> unusedColumns;}
+                if (s & FLIP_VERTICAL) {bb = flipVertical(bb) >> (unusedColumns * bitboard::ROW_SIZE);}
+                if (s & TRANSPOSE) {bb = transpose(bb);}
+                return bb;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the symmetry that undoes the given
+            ///        symmetry
+            ///
+            /// The mirror and flip are their own inverses, but when the
+            /// board is transposed, mirroring before it is the same as
+            /// flipping after it (and vice versa), so the two swap
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline constexpr uint8_t inverse(const uint8_t& s)
+            {
+                return (s & TRANSPOSE) ?
+                       static_cast<uint8_t>(TRANSPOSE | ((s & MIRROR_HORIZONTAL) << 1) | ((s & FLIP_VERTICAL) >> 1)) :
+                       s;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get where a tile ends up after applying
+            ///        a symmetry
+            ///
+            /// \param index The bit index of the tile
+            /// \param s The symmetry
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline uint8_t transformIndex(const uint8_t& index, const uint8_t& s)
+            {
+                return bitboard::lowestIndex(transform(bitboard::toBit(index), s));
+            }
+
+        }
+
+    }
+
+}
+
+#endif //OTHELLO_GAME_SYMMETRY_HPP
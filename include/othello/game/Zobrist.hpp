@@ -0,0 +1,113 @@
+#ifndef OTHELLO_GAME_ZOBRIST_HPP
+#define OTHELLO_GAME_ZOBRIST_HPP
+
+//Standard C++:
+#include <array>
+//Othello headers:
+#include <othello/game/Bitboard.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \brief Convenience typedef for a Zobrist hash of a position
+        ///
+        ////////////////////////////////////////////////////////////////
+        typedef uint64_t hash_t;
+
+
+        namespace zobrist
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \struct Keys
+            ///
+            /// \brief Struct containing the random keys that are XORed
+            ///        together to hash a position
+            ///
+            /// The keys are generated at compile time with a fixed seed, so
+            /// hashes are the same in every run and on every machine (and
+            /// can be stored in files)
+            ///
+            ////////////////////////////////////////////////////////////////
+            struct Keys
+            {
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The key of a disk of each player on each tile
+                ///
+                ////////////////////////////////////////////////////////////////
+                hash_t disks[2][64];
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The keys of both players on each tile XORed together,
+                ///        i.e. the change when a disk on the tile is flipped
+                ///
+                ////////////////////////////////////////////////////////////////
+                hash_t flips[64];
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The key XORed in when it's player 2's turn
+                ///
+                ////////////////////////////////////////////////////////////////
+                hash_t secondPlayer;
+                
+            };
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The keys used by every hash
+            ///
+            ////////////////////////////////////////////////////////////////
+            extern const Keys KEYS;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to hash a position from scratch
+            ///
+            /// \param disks The disks of each player
+            /// \param currentPlayer The index of the player whose turn it is
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline hash_t hash(const std::array<bitboard_t, 2>& disks, const uint8_t& currentPlayer)
+            {
+                hash_t h = currentPlayer ? KEYS.secondPlayer : 0;
+                
+                //XOR in the key of every disk
+                for (uint8_t p = 0; p < 2; ++p)
+                {
+                    bitboard_t bb = disks[p];
+                    while (bb) {h ^= KEYS.disks[p][bitboard::popLowest(bb)];}
+                }
+                
+                return h;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the change in the hash when a player
+            ///        places a disk and flips the given disks
+            ///
+            /// \note Doesn't include the change of player
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline hash_t moveKey(const uint8_t& player, const uint8_t& square, bitboard_t flips)
+            {
+                hash_t h = KEYS.disks[player][square];
+                while (flips) {h ^= KEYS.flips[bitboard::popLowest(flips)];}
+                return h;
+            }
+
+        }
+
+    }
+
+}
+
+#endif //OTHELLO_GAME_ZOBRIST_HPP
@@ -0,0 +1,162 @@
+#ifndef OTHELLO_UTIL_CPUFEATURES_HPP
+#define OTHELLO_UTIL_CPUFEATURES_HPP
+
+//Standard C++:
+#include <cstdint>
+#include <string>
+
+
+//The vectorised kernels are compiled for every instruction set (with target
+//attributes and pragmas) when building for x86 with GCC, and picked at
+//runtime. Otherwise only the scalar kernels are compiled
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__clang__)
+#define OTHELLO_X86_KERNELS
+#define OTHELLO_TARGET(features) __attribute__((target(features)))
+//The intrinsics of every instruction set can be used in functions that
+//target it
+#include <immintrin.h>
+#endif
+
+
+namespace othello
+{
+
+    namespace util
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \class CpuFeatures
+        ///
+        /// \brief Static class for detecting the instruction sets the
+        ///        CPU supports and choosing which ones the kernels use
+        ///
+        /// The CPU is checked (with cpuid) when the program starts, and
+        /// every supported feature is enabled, so one binary runs the
+        /// fastest kernels on any x86 CPU. The enabled features can be
+        /// restricted afterwards to compare the kernels
+        ///
+        ////////////////////////////////////////////////////////////////
+        class CpuFeatures
+        {
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The features the kernels can use, as bit flags
+                ///
+                ////////////////////////////////////////////////////////////////
+                enum Feature : uint8_t
+                {
+                    NONE = 0,
+                    AVX2 = 1u << 0u,
+                    BMI2 = 1u << 1u,
+                    AVX512 = 1u << 2u, //AVX-512 F and BW
+                    ALL = AVX2 | BMI2 | AVX512
+                };
+
+
+            private:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The features the CPU supports
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint8_t supported;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The features the kernels use
+                ///
+                /// \note Zero (the scalar kernels) until the CPU has been
+                ///       checked, so kernels used by other static
+                ///       initialisers are always safe
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint8_t enabled;
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to check which features the CPU supports
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint8_t detect();
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the supported features that are
+                ///        worth using by default
+                ///
+                /// BMI2 is supported by AMD CPUs before Zen 3, but PEXT and
+                /// PDEP are microcoded and slower than the tables
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint8_t getDefault();
+
+
+            public:
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to determine if the CPU supports the
+                ///        instructions the whole program was compiled with
+                ///        (POPCNT, unless OTHELLO_ENABLE_POPCNT is off)
+                ///
+                ////////////////////////////////////////////////////////////////
+                static bool isBaselineSupported();
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the features the CPU supports
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint8_t getSupported() {return supported;}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the features the kernels use
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint8_t getEnabled() {return enabled;}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to determine if the kernels use a feature
+                ///
+                /// Cheap enough to check on every call of a kernel
+                ///
+                ////////////////////////////////////////////////////////////////
+                static bool isEnabled(const Feature& feature) {return enabled & feature;}
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to set the features the kernels use
+                ///
+                /// \note Features the CPU doesn't support are never enabled.
+                ///       Must be called before any other threads are started
+                ///
+                ////////////////////////////////////////////////////////////////
+                static void setEnabled(const uint8_t& features);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to get the names of features as a comma
+                ///        separated list ("none" if there are none)
+                ///
+                ////////////////////////////////////////////////////////////////
+                static std::string toString(const uint8_t& features);
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to read a comma separated list of feature
+                ///        names ("avx2", "bmi2", "avx512", "all" or "none")
+                ///
+                /// \throws std::invalid_argument if a name isn't a feature
+                ///
+                ////////////////////////////////////////////////////////////////
+                static uint8_t fromString(const std::string& str);
+
+        };
+
+    }
+
+}
+
+#endif //OTHELLO_UTIL_CPUFEATURES_HPP
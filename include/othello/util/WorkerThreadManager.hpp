@@ -105,10 +105,10 @@ namespace othello
                         //
                         //basically, here by dangerous template magicks
                         template<std::size_t... Is>
-                        void callFunc(std::function<RetT(ArgsT...)> func,
+                        RetT callFunc(std::function<RetT(ArgsT...)> func,
                                 std::index_sequence<Is...>)
                         {
-                            returnVal.assign(func(std::get<Is>(args.get())...));
+                            return func(std::get<Is>(args.get())...);
                         }
                         
                         
@@ -140,10 +140,13 @@ namespace othello
                                             //Unlock the lock while we're working
                                             lock.unlock();
                                             
+                                            //(a job that throws still completes, with a value
+                                            //initialised result, so nobody waits for it forever)
+                                            RetT result = RetT();
                                             try
                                             {
                                                 //Do some work
-                                                callFunc(function, std::index_sequence_for<ArgsT...>{});
+                                                result = callFunc(function, std::index_sequence_for<ArgsT...>{});
                                             }
                                             catch (const std::exception& e)
                                             {
@@ -154,11 +157,17 @@ namespace othello
                                                 std::cerr << "Unknown exception caught in worker thread" << std::endl;
                                             }
                                             
-                                            //Relock the lock
+                                            //The work is complete, so become available before
+                                            //updating the future value (a thread waiting for it
+                                            //can then give this worker another job straight away)
+                                            FutureValue<RetT> futureVal = returnVal;
                                             lock.lock();
-                                            
-                                            //The work is complete
                                             hasWork = false;
+                                            lock.unlock();
+                                            futureVal.assign(result);
+                                            
+                                            //Relock the lock
+                                            lock.lock();
                                         }
                                     });
                         }
@@ -290,7 +299,27 @@ namespace othello
                     }
                     return false;
                 }
-                
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to determine if every worker is available
+                ///
+                /// \note A lock should be obtained before calling this function
+                ///
+                /// \note A worker becomes available just before its future value
+                ///       is updated, so wait for the future values of the jobs
+                ///       to know they're complete instead of polling this
+                ///
+                ////////////////////////////////////////////////////////////////
+                bool areAllWorkersAvailable() const
+                {
+                    for (const auto& worker : workers)
+                    {
+                        if (!worker->isAvailable()) {return false;}
+                    }
+                    return true;
+                }
+
                 
                 ////////////////////////////////////////////////////////////////
                 /// \brief Function to tell a worker to do some work
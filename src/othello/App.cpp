@@ -1,16 +1,24 @@
 //Standard C++:
 #include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <unordered_set>
 //Boost headers:
 #include <boost/program_options.hpp>
 //Othello headers:
 #include <othello/App.hpp>
 #include <othello/game/Game.hpp>
+#include <othello/game/BoardBatch.hpp>
+#include <othello/game/Perft.hpp>
 #include <othello/cmd/BoardPrinter.hpp>
 #include <othello/cmd/HumanPlayer.hpp>
 #include <othello/ai/RandomPlayer.hpp>
 #include <othello/ai/HeuristicPlayer.hpp>
 #include <othello/ai/AlphaBetaPruningPlayer.hpp>
+#include <othello/ai/EndgameSolver.hpp>
+#include <othello/ai/OpeningBook.hpp>
 #include <othello/ai/QLearningPlayer.hpp>
+#include <othello/util/CpuFeatures.hpp>
 
 
 #define OTHELLO_VERSION "1.0"
@@ -22,6 +30,13 @@ namespace othello
     ////////////////////////////////////////////////////////////////
     int App::run(const int& argc, char** argv)
     {
+        //Make sure the CPU can run the program at all
+        if (!util::CpuFeatures::isBaselineSupported())
+        {
+            std::cerr << "This CPU doesn't support POPCNT. Rebuild with OTHELLO_ENABLE_POPCNT off" << std::endl;
+            return EXIT_FAILURE;
+        }
+        
         try
         {
             //The player types
@@ -34,8 +49,20 @@ namespace othello
             unsigned int testingStartFromTurn;
             //The search depth
             unsigned int searchDepth;
+            //The time limit of each move in ms
+            unsigned int timePerMove;
+            //The node limit of each move
+            uint64_t nodesPerMove;
             //The number of threads
             unsigned int numThreads;
+            //The size of the transposition table in MB
+            unsigned int hashSize;
+            //The number of empty tiles at which games are solved
+            unsigned int endgameEmpties;
+            //The number of empty tiles at which test games are adjudicated
+            unsigned int adjudicateEmpties;
+            //How sure ProbCut has to be to prune, in standard deviations
+            double probCutThreshold;
             //The random generator seed
             unsigned int seed;
             //The output file
@@ -72,21 +99,147 @@ namespace othello
                     ("search-depth,sd", boost::program_options::value<unsigned int>(&searchDepth)->default_value(3),
                             "The maximum number of moves an AI will look ahead. "
                             "Only applicable to players that try to predict moves, such as ai_ab_minimax. "
-                            "Larger numbers exponentially affect speed and memory use. Default is 3")
+                            "Larger numbers exponentially affect speed and memory use. "
+                            "If --time-per-move or --nodes-per-move is included, this is the maximum and is unlimited "
+                            "by default. Default is 3")
+                    ("time-per-move", boost::program_options::value<unsigned int>(&timePerMove)->default_value(0),
+                            "The time in ms an AI can take for each move, searching one move further ahead at a time "
+                            "until it runs out. "
+                            "Only applicable to players that try to predict moves, such as ai_ab_minimax. "
+                            "If set to 0, there is no limit. Default is 0")
+                    ("nodes-per-move", boost::program_options::value<uint64_t>(&nodesPerMove)->default_value(0),
+                            "The number of positions an AI can search for each move, searching one move further ahead "
+                            "at a time until it runs out. Unlike --time-per-move, the moves don't depend on the speed "
+                            "of the computer when --num-threads is 0 (searching on the main thread only). "
+                            "Only applicable to players that try to predict moves, such as ai_ab_minimax. "
+                            "If set to 0, there is no limit. Default is 0")
                     ("num-threads,nt", boost::program_options::value<unsigned int>(&numThreads)->default_value(4),
                             "The number of worker threads an AI will use when determining moves. "
                             "Only applicable to players that use multithreading, such as ai_ab_minimax. "
                             "Default is 4")
+                    ("hash-size", boost::program_options::value<unsigned int>(&hashSize)->default_value(16),
+                            "The size of an AI's transposition table in MB, which is shared by its threads and kept "
+                            "between moves and games. "
+                            "Only applicable to players that search, such as ai_ab_minimax. "
+                            "If set to 0, the table is disabled. Default is 16")
+                    ("huge-pages", "Asks the OS to back the transposition tables with huge pages, "
+                                   "which can make large tables faster")
+                    ("move-ordering", boost::program_options::value<std::string>()->default_value("all"),
+                            "The ways an AI orders the moves it searches, as a comma separated list of "
+                            "tt (the best move stored in the transposition table), killers, history, "
+                            "squares (corners first and X-squares last), fastest-first and shallow-search "
+                            "(or all or none). Useful for comparing the number of positions searched. "
+                            "Only applicable to players that search, such as ai_ab_minimax. Default is all")
+                    ("search-algorithm", boost::program_options::value<std::string>()->default_value("pvs"),
+                            "The algorithm an AI searches with: alpha-beta, pvs (principal variation search) or mtdf "
+                            "(MTD(f)). The number of positions each AI searched is printed after each cycle, "
+                            "to compare them. "
+                            "Only applicable to players that search, such as ai_ab_minimax. Default is pvs")
+                    ("endgame-empties", boost::program_options::value<unsigned int>(&endgameEmpties)->default_value(12),
+                            "The number of empty tiles at which an AI stops searching with the heuristic and solves "
+                            "the rest of the game, playing perfectly. "
+                            "With --time-per-move or --nodes-per-move, solving gets a quarter of the budget, and the "
+                            "game is searched with the rest if it runs out. "
+                            "Only applicable to players that search, such as ai_ab_minimax. "
+                            "If set to 0, games are never solved. Default is 12")
+                    ("endgame-mode", boost::program_options::value<std::string>()->default_value("exact"),
+                            "What solving a game finds out: exact (the final disk difference) or wld (only whether "
+                            "it's a win, loss or draw, which is faster but can lose disks in won games). "
+                            "Default is exact")
+                    ("adjudicate-empties", boost::program_options::value<unsigned int>(&adjudicateEmpties)->default_value(0),
+                            "The number of empty tiles at which test games are finished with perfect play for both "
+                            "players, so the results only depend on the players' play until then. "
+                            "Uses the following options: --endgame-mode, --hash-size. "
+                            "If set to 0, test games are played to the end by the players. Default is 0")
+                    ("probcut", boost::program_options::value<double>(&probCutThreshold)->default_value(0),
+                            "How many standard deviations a shallow search has to predict a search is outside its "
+                            "window by for an AI to prune it (ProbCut), which lets it search deeper in the same time "
+                            "but sometimes misses moves. 1.5 is a good start. "
+                            "Only applicable to players that search, such as ai_ab_minimax. "
+                            "If set to 0, nothing is pruned. Default is 0")
+                    ("probcut-params", boost::program_options::value<std::string>()->default_value(""),
+                            "The path to a file of ProbCut parameters written by --calibrate-probcut. "
+                            "If not included, the built in parameters are used (there are only ones for 8x8 boards)")
+                    ("book", boost::program_options::value<std::string>()->default_value(""),
+                            "The path to an opening book written by --build-book, which AIs play one of the best "
+                            "moves from instead of searching while the board is in it. The file is memory-mapped, so "
+                            "processes using the same book share it. "
+                            "Only applicable to players that search, such as ai_ab_minimax. "
+                            "If not included, every move is searched")
+                    ("ponder", "Lets an AI keep searching with its worker threads (see --num-threads) while its "
+                               "opponent picks a move, so it finds its next move sooner. "
+                               "Useful against human players. "
+                               "Only applicable to players that search, such as ai_ab_minimax")
+                    ("search-stats", "Prints the statistics of every search an AI makes a move with: the nodes, "
+                                     "leaves and nodes per second, the cutoff rate of the first move, the effective "
+                                     "branching factor, the transposition table probes, hits and stores, and the time "
+                                     "of each iteration and root move. "
+                                     "Only applicable to players that search, such as ai_ab_minimax")
                     ("seed,s", boost::program_options::value<unsigned int>(&seed)->default_value(0),
                             "An unsigned integer to be used as the seed for all random number generators. "
                             "A value of 0 will use the current time in seconds since Epoch as the seed. "
                             "Default is 0")
                     ("switch-players", "This option will swap player 1 and 2 every turn. "
                                        "Useful for training")
+                    ("unique-openings", "When games start from a later turn, only play one of each set of starting states "
+                                        "that are rotations or reflections of each other. "
+                                        "Recommended for deterministic players such as ai_heur")
                     ("out,o", boost::program_options::value<std::string>(&outFile)->default_value("./out.csv"),
                             "The path to the file to output statistics, as a csv. "
                             "Default is ./out.csv");
             
+            //Create the tool options description object
+            boost::program_options::options_description toolOptions("Tool Options");
+            //Add the options
+            toolOptions.add_options()
+                    ("perft", boost::program_options::value<unsigned int>(),
+                            "Counts the positions the given number of moves ahead (passes count as a move) and prints "
+                            "the time taken, instead of playing games. "
+                            "Uses the following options: --position, --divide, --num-threads, --perft-hash-size")
+                    ("divide", "Prints the --perft count below each possible move")
+                    ("solve", "Solves the --position to the end of the game and prints its result, best moves and "
+                              "the time taken, instead of playing games. "
+                              "Uses the following options: --position, --endgame-mode, --hash-size")
+                    ("calibrate-probcut", boost::program_options::value<std::string>(),
+                            "Fits the ProbCut parameters to positions from self-play games, prints them and writes "
+                            "them to the given file (for --probcut-params), instead of playing games. "
+                            "Uses the following options: --calibration-games, --calibration-depth, --seed, --hash-size")
+                    ("calibration-games", boost::program_options::value<unsigned int>()->default_value(50),
+                            "The number of self-play games to take positions from for --calibrate-probcut. "
+                            "Default is 50")
+                    ("calibration-depth", boost::program_options::value<unsigned int>()->default_value(8),
+                            "The deepest search to fit parameters for with --calibrate-probcut. "
+                            "Deeper searches use the parameters of the deepest ones. "
+                            "Default is 8")
+                    ("build-book", boost::program_options::value<std::string>(),
+                            "Builds an opening book (for --book) of every position up to --book-depth moves from the "
+                            "start, valued by searching the last ones and backing the values up with minimax, and "
+                            "writes it to the given file, instead of playing games. "
+                            "Uses the following options: --book-depth, --book-search-depth, --num-threads, --hash-size, "
+                            "--seed")
+                    ("book-depth", boost::program_options::value<unsigned int>()->default_value(6),
+                            "The number of moves from the start the positions of --build-book go to. "
+                            "Each move multiplies the positions (and the time) by about 5. "
+                            "Default is 6")
+                    ("book-search-depth", boost::program_options::value<unsigned int>()->default_value(8),
+                            "The depth the last positions of --build-book are searched to. "
+                            "Default is 8")
+                    ("position", boost::program_options::value<std::string>()->default_value(""),
+                            "The position to start from, as every tile from the top-left ('X', 'O' or '-') "
+                            "optionally followed by the player to move ('X' or 'O'). "
+                            "If not included, the default starting position is used")
+                    ("perft-hash-size", boost::program_options::value<unsigned int>()->default_value(0),
+                            "The size of the hash table of each --perft thread in MB. "
+                            "If set to 0, hashing is disabled. "
+                            "Default is 0")
+                    ("cpu-features", "Prints the CPU features (instruction sets) the board kernels can use "
+                                     "and the ones they're using, instead of playing games")
+                    ("use-cpu-features", boost::program_options::value<std::string>(),
+                            "Only lets the board kernels use the given CPU features, as a comma separated list of "
+                            "avx2, bmi2 and avx512 (or all or none). Useful for comparing the speed of the kernels. "
+                            "Features the CPU doesn't support are never used. "
+                            "If not included, every supported feature is used");
+            
             //Create the player options
             boost::program_options::options_description playerOptions("Player Options");
             //Add the options
@@ -101,7 +254,9 @@ namespace othello
                             "A deterministic player that uses a positional heuristic table to choose moves")
                     ("player=ai_ab_minimax",
                             "A player that uses Alpha Beta Pruning, a positional heuristic table and a random number generator to choose moves. "
-                            "Uses the following options: --search-depth, --num-threads, --seed")
+                            "Uses the following options: --search-depth, --time-per-move, --nodes-per-move, --num-threads, "
+                            "--hash-size, --huge-pages, --move-ordering, --search-algorithm, --endgame-empties, "
+                            "--endgame-mode, --probcut, --probcut-params, --book, --ponder, --search-stats, --seed")
                     ("player=ai_q_learn",
                             " A player that uses a multilayer perceptron neural network, Q learning and a random number generator to choose moves. "
                             "Uses the following options: --seed. "
@@ -187,11 +342,11 @@ namespace othello
             
             //Create an options description object for all the options
             boost::program_options::options_description allOptions("");
-            allOptions.add(generalOptions).add(trainingOptions);
+            allOptions.add(generalOptions).add(trainingOptions).add(toolOptions);
             
             //Create a display options description object for all the options
             boost::program_options::options_description allDisplayOptions("");
-            allDisplayOptions.add(generalOptions).add(playerOptions).add(trainingOptions);
+            allDisplayOptions.add(generalOptions).add(playerOptions).add(trainingOptions).add(toolOptions);
             
             //Create the variables map
             boost::program_options::variables_map variablesMap;
@@ -231,6 +386,170 @@ namespace othello
                 return EXIT_SUCCESS;
             }
             
+            //If the kernels should only use some CPU features
+            if (variablesMap.count("use-cpu-features"))
+            {
+                util::CpuFeatures::setEnabled(
+                        util::CpuFeatures::fromString(variablesMap["use-cpu-features"].as<std::string>()));
+            }
+            
+            //If the user wants to know the CPU features
+            if (variablesMap.count("cpu-features"))
+            {
+                std::cout << "Supported CPU features: "
+                          << util::CpuFeatures::toString(util::CpuFeatures::getSupported()) << std::endl;
+                std::cout << "Enabled CPU features: "
+                          << util::CpuFeatures::toString(util::CpuFeatures::getEnabled()) << std::endl;
+                std::cout << "Boards per batch kernel: " << game::BoardBatch::getVectorWidth() << std::endl;
+                return EXIT_SUCCESS;
+            }
+            
+            //If the user wants to count positions
+            //(checked before the options are, as players aren't needed)
+            if (variablesMap.count("perft"))
+            {
+                const unsigned int depth = variablesMap["perft"].as<unsigned int>();
+                const unsigned int threads = std::max(variablesMap["num-threads"].as<unsigned int>(), 1u);
+                const std::size_t hashSize = std::size_t(variablesMap["perft-hash-size"].as<unsigned int>()) << 20u;
+                
+                //Get the starting position
+                const std::string& position = variablesMap["position"].as<std::string>();
+                const game::Board board = position.empty() ? game::Board() : game::Board::fromString(position);
+                std::cout << "Perft " << depth << " of " << board.toString() << std::endl;
+                
+                //Count the positions
+                const auto start = std::chrono::steady_clock::now();
+                const auto results = game::Perft::divide(board, static_cast<uint8_t>(depth), threads, hashSize);
+                const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                
+                //Add up (and maybe print) the counts of each move
+                uint64_t nodes = results.empty() ? 1 : 0;
+                for (const auto& result : results)
+                {
+                    if (variablesMap.count("divide"))
+                    {
+                        const game::TilePosition pos = game::bitboard::toPosition(result.first);
+                        std::cout << static_cast<char>('a' + pos.x) << pos.y + 1 << ": " << result.second << std::endl;
+                    }
+                    nodes += result.second;
+                }
+                
+                std::cout << "Nodes: " << nodes << std::endl;
+                std::cout << "Time: " << std::fixed << std::setprecision(3) << seconds << "s" << std::endl;
+                std::cout << "Nodes/second: " << std::setprecision(0) << (seconds > 0 ? nodes / seconds : 0)
+                          << std::endl;
+                return EXIT_SUCCESS;
+            }
+            
+            //If the user wants to solve a position
+            if (variablesMap.count("solve"))
+            {
+                const ai::EndgameSolver::Mode mode =
+                        ai::EndgameSolver::modeFromString(variablesMap["endgame-mode"].as<std::string>());
+                const std::size_t tableSize = std::size_t(variablesMap["hash-size"].as<unsigned int>()) << 20u;
+                
+                //Get the position
+                const std::string& position = variablesMap["position"].as<std::string>();
+                const game::Board board = position.empty() ? game::Board() : game::Board::fromString(position);
+                std::cout << "Solve (" << ai::EndgameSolver::toString(mode) << ") of " << board.toString() << std::endl;
+                if (board.isOver())
+                {
+                    std::cout << "The game is over" << std::endl;
+                    return EXIT_SUCCESS;
+                }
+                
+                //Solve it
+                ai::TranspositionTable table(tableSize, variablesMap.count("huge-pages"));
+                ai::EndgameSolver solver(&table);
+                std::vector<uint8_t> bestSquares;
+                const auto start = std::chrono::steady_clock::now();
+                const int result = solver.solve(board, mode, bestSquares);
+                const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                
+                //The result is from the point of view of the player to move
+                std::cout << "Player to move: " << (board.getCurrentPlayer() ? 'O' : 'X') << std::endl;
+                std::cout << "Result: ";
+                if (mode == ai::EndgameSolver::EXACT) {std::cout << std::showpos << result << std::noshowpos;}
+                else {std::cout << (result > 0 ? "win" : result < 0 ? "loss" : "draw");}
+                std::cout << std::endl << "Best moves:";
+                for (const uint8_t& square : bestSquares)
+                {
+                    const game::TilePosition pos = game::bitboard::toPosition(square);
+                    std::cout << " " << static_cast<char>('a' + pos.x) << pos.y + 1;
+                }
+                std::cout << std::endl;
+                
+                std::cout << "Nodes: " << solver.getNodeCount() << std::endl;
+                std::cout << "Time: " << std::fixed << std::setprecision(3) << seconds << "s" << std::endl;
+                std::cout << "Nodes/second: " << std::setprecision(0)
+                          << (seconds > 0 ? solver.getNodeCount() / seconds : 0) << std::endl;
+                return EXIT_SUCCESS;
+            }
+            
+            //If the user wants to calibrate ProbCut
+            if (variablesMap.count("calibrate-probcut"))
+            {
+                const std::string& path = variablesMap["calibrate-probcut"].as<std::string>();
+                const unsigned int numGames = variablesMap["calibration-games"].as<unsigned int>();
+                const uint8_t maxDepth = static_cast<uint8_t>(std::max<unsigned int>(ai::ProbCut::MIN_DEPTH,
+                        std::min<unsigned int>(variablesMap["calibration-depth"].as<unsigned int>(), ai::ProbCut::MAX_DEPTH)));
+                unsigned int calibrationSeed = variablesMap["seed"].as<unsigned int>();
+                if (calibrationSeed == 0) {calibrationSeed = static_cast<unsigned int>(std::time(nullptr));}
+                const std::size_t tableSize = std::size_t(variablesMap["hash-size"].as<unsigned int>()) << 20u;
+                std::cout << "Calibrating ProbCut from " << numGames << " games to depth " << int(maxDepth)
+                          << " (seed " << calibrationSeed << ")" << std::endl;
+                
+                const auto start = std::chrono::steady_clock::now();
+                const ai::ProbCut probCut = ai::ProbCut::calibrate(numGames, maxDepth, calibrationSeed, tableSize, 0);
+                const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                
+                //Print the fitted parameters
+                std::cout << "Depth  Shallow  Slope   Intercept  Sigma" << std::endl;
+                for (uint8_t depth = ai::ProbCut::MIN_DEPTH; depth <= maxDepth; ++depth)
+                {
+                    for (uint8_t check = 0; check < ai::ProbCut::NUM_CHECKS; ++check)
+                    {
+                        const ai::ProbCut::Parameters& parameters = probCut.getParameters(depth, check);
+                        if (parameters.slope <= 0 || depth < ai::ProbCut::REDUCTIONS[check]) {continue;}
+                        std::cout << std::fixed << std::setprecision(3) << std::setw(5) << int(depth)
+                                  << std::setw(9) << int(depth - ai::ProbCut::REDUCTIONS[check])
+                                  << std::setw(7) << parameters.slope << std::setw(11) << parameters.intercept
+                                  << std::setw(9) << parameters.sigma << std::endl;
+                    }
+                }
+                std::cout << "Time: " << std::setprecision(3) << seconds << "s" << std::endl;
+                
+                probCut.save(path);
+                std::cout << "Written to " << path << std::endl;
+                return EXIT_SUCCESS;
+            }
+            
+            //If the user wants to build an opening book
+            if (variablesMap.count("build-book"))
+            {
+                const std::string& path = variablesMap["build-book"].as<std::string>();
+                const uint8_t bookDepth = static_cast<uint8_t>(std::min<unsigned int>(
+                        variablesMap["book-depth"].as<unsigned int>(), game::Board::BOARD_SIZE * game::Board::BOARD_SIZE));
+                const uint8_t bookSearchDepth = static_cast<uint8_t>(std::max(1u, std::min<unsigned int>(
+                        variablesMap["book-search-depth"].as<unsigned int>(), game::Board::BOARD_SIZE * game::Board::BOARD_SIZE)));
+                const unsigned int threads = std::max(variablesMap["num-threads"].as<unsigned int>(), 1u);
+                unsigned int bookSeed = variablesMap["seed"].as<unsigned int>();
+                if (bookSeed == 0) {bookSeed = static_cast<unsigned int>(std::time(nullptr));}
+                const std::size_t tableSize = std::size_t(variablesMap["hash-size"].as<unsigned int>()) << 20u;
+                std::cout << "Building an opening book " << int(bookDepth) << " moves deep, searched to depth "
+                          << int(bookSearchDepth) << " with " << threads << " threads" << std::endl;
+                
+                const auto start = std::chrono::steady_clock::now();
+                const std::size_t numPositions = ai::OpeningBook::build(path, bookDepth, bookSearchDepth, threads,
+                                                                        tableSize, bookSeed);
+                const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                
+                std::cout << "Positions: " << numPositions << std::endl;
+                std::cout << "Time: " << std::fixed << std::setprecision(3) << seconds << "s" << std::endl;
+                std::cout << "Written to " << path << std::endl;
+                return EXIT_SUCCESS;
+            }
+            
             //Check the options
             boost::program_options::notify(variablesMap);
             
@@ -248,6 +567,42 @@ namespace othello
             bool switchPlayers = variablesMap.count("switch-players");
             //If the program is in training mode
             bool training = variablesMap.count("training");
+            //If symmetric starting states should be skipped
+            bool uniqueOpenings = variablesMap.count("unique-openings");
+            //If the transposition tables should use huge pages
+            bool hugePages = variablesMap.count("huge-pages");
+            //If the statistics of every search should be printed
+            bool searchStats = variablesMap.count("search-stats");
+            //If the AIs should search on their opponents' time
+            bool ponder = variablesMap.count("ponder");
+            //The ways the moves of searches are ordered
+            const uint8_t moveOrdering = ai::MoveOrderer::fromString(variablesMap["move-ordering"].as<std::string>());
+            //The algorithm searches use
+            const ai::AlphaBetaPruningPlayer::Algorithm searchAlgorithm =
+                    ai::AlphaBetaPruningPlayer::algorithmFromString(variablesMap["search-algorithm"].as<std::string>());
+            //What solving games finds out
+            const ai::EndgameSolver::Mode endgameMode =
+                    ai::EndgameSolver::modeFromString(variablesMap["endgame-mode"].as<std::string>());
+            
+            //The ProbCut parameters, read from a file if one is given
+            ai::ProbCut probCut(probCutThreshold);
+            const std::string& probCutParams = variablesMap["probcut-params"].as<std::string>();
+            if (!probCutParams.empty()) {probCut.load(probCutParams);}
+            
+            //The opening book, shared by every AI
+            std::shared_ptr<const ai::OpeningBook> book;
+            const std::string& bookPath = variablesMap["book"].as<std::string>();
+            if (!bookPath.empty()) {book = std::make_shared<const ai::OpeningBook>(bookPath);}
+            
+            //There are never more empty tiles than tiles
+            endgameEmpties = std::min<unsigned int>(endgameEmpties, game::Board::BOARD_SIZE * game::Board::BOARD_SIZE);
+            adjudicateEmpties = std::min<unsigned int>(adjudicateEmpties, game::Board::BOARD_SIZE * game::Board::BOARD_SIZE);
+            
+            //With a budget, the depth is only limited if it's given
+            if ((timePerMove || nodesPerMove) && variablesMap["search-depth"].defaulted())
+            {
+                searchDepth = game::Board::BOARD_SIZE * game::Board::BOARD_SIZE;
+            }
             
             //If the number of training games is 0
             if (numTrainingGames == 0)
@@ -292,8 +647,14 @@ namespace othello
                 else if ((!training || i != 0) && playerType == "ai_heur") {players[i].reset(new othello::ai::HeuristicPlayer());}
                 else if ((!training || i != 0) && playerType == "ai_ab_minimax")
                 {
-                    players[i].reset(new othello::ai::AlphaBetaPruningPlayer(
-                            searchDepth, numThreads, seed));
+                    auto player = std::make_shared<othello::ai::AlphaBetaPruningPlayer>(
+                            searchDepth, std::chrono::milliseconds(timePerMove), nodesPerMove, numThreads, seed,
+                            std::size_t(hashSize) << 20u, hugePages, moveOrdering, searchAlgorithm,
+                            static_cast<uint8_t>(endgameEmpties), endgameMode, probCut);
+                    player->enableStatisticsLog(searchStats);
+                    player->enablePondering(ponder);
+                    player->setOpeningBook(book);
+                    players[i] = player;
                 }
                 else if (playerType == "ai_q_learn") {players[i].reset(new othello::ai::QLearningPlayer(
                         false, seed, numCycles, numHiddenLayers, numHiddenNeurons, discountFactor, learningRate, epsilon));}
@@ -326,6 +687,16 @@ namespace othello
                 testGame.setPlayers(players[0], players[2]);
             }
             
+            //If test games should be finished with perfect play
+            if (adjudicateEmpties)
+            {
+                //(the adjudicator solves every position it's asked about)
+                testGame.setAdjudicator(std::make_shared<ai::AlphaBetaPruningPlayer>(
+                        1, std::chrono::milliseconds(0), 0, 0, seed, std::size_t(hashSize) << 20u, hugePages,
+                        moveOrdering, searchAlgorithm, static_cast<uint8_t>(adjudicateEmpties), endgameMode, probCut),
+                        static_cast<uint8_t>(adjudicateEmpties));
+            }
+            
             //Create the info string stream
             std::stringstream infoStrStream;
             infoStrStream << "==============INFO==============" << std::endl;
@@ -343,9 +714,24 @@ namespace othello
             infoStrStream << "Num test games: " << numTestGames << std::endl;
             infoStrStream << "Testing start from turn: " << testingStartFromTurn << std::endl;
             infoStrStream << "Search depth: " << searchDepth << std::endl;
+            infoStrStream << "Time per move: " << timePerMove << " ms" << std::endl;
+            infoStrStream << "Nodes per move: " << nodesPerMove << std::endl;
             infoStrStream << "Num threads: " << numThreads << std::endl;
+            infoStrStream << "Search algorithm: " << ai::AlphaBetaPruningPlayer::toString(searchAlgorithm) << std::endl;
+            infoStrStream << "Move ordering: " << ai::MoveOrderer::toString(moveOrdering) << std::endl;
+            infoStrStream << "Hash size: " << hashSize << " MB" << (hugePages ? " (huge pages)" : "") << std::endl;
+            infoStrStream << "Endgame empties: " << endgameEmpties << std::endl;
+            infoStrStream << "Endgame mode: " << ai::EndgameSolver::toString(endgameMode) << std::endl;
+            infoStrStream << "Adjudicate empties: " << adjudicateEmpties << std::endl;
+            infoStrStream << "ProbCut: " << probCutThreshold
+                          << (probCutParams.empty() ? "" : " (" + probCutParams + ")") << std::endl;
+            infoStrStream << "Book: " << (book ? bookPath + " (" + std::to_string(book->size()) + " positions)" : "none")
+                          << std::endl;
+            infoStrStream << "Ponder? " << (ponder ? "true" : "false") << std::endl;
+            infoStrStream << "Search stats? " << (searchStats ? "true" : "false") << std::endl;
             infoStrStream << "Seed: " << seed << std::endl;
             infoStrStream << "Switch players? " << (switchPlayers ? "true" : "false") << std::endl;
+            infoStrStream << "Unique openings? " << (uniqueOpenings ? "true" : "false") << std::endl;
             infoStrStream << "Output file: " << outFile << std::endl;
             infoStrStream << std::endl;
             
@@ -377,14 +763,14 @@ namespace othello
             //Create a pre turn callback
             auto preTurnCallback = [&](const game::Game& game, const uint8_t& player)
             {
-                //Create an empty vector of possible moves
-                std::vector<game::Move> possibleMoves;
+                //Create an empty list of possible moves
+                game::MoveList possibleMoves;
     
                 //If the possible moves should be displayed
                 if (displayPossibleMoves)
                 {
                     //Get the possible moves
-                    possibleMoves = game.getBoard().getPossibleMoves();
+                    game.getBoard().getPossibleMoves(possibleMoves);
                 }
     
                 //If the board shouldn't be hidden or the player is a human
@@ -427,15 +813,23 @@ namespace othello
             trainingGame.addWinCallback(winCallback);
             testGame.addWinCallback(winCallback);
             
+            //The canonical forms of the starting states that have been played
+            //(only used with --unique-openings)
+            std::unordered_set<game::Board> playedOpenings;
+            
             //Create a lambda for starting games
             //for all the possible moves up to a certain depth
-            std::function<void(game::Game&, unsigned int &, unsigned int, const game::Board&)>
+            //(the moves are made and undone on the one board)
+            std::function<void(game::Game&, unsigned int &, unsigned int, game::Board&)>
                     startGamesForPossibleMoves =
-                    [&](game::Game& game, unsigned int& counter, unsigned int depth, const game::Board& board)
+                    [&](game::Game& game, unsigned int& counter, unsigned int depth, game::Board& board)
                     {
                         //If the depth is 0
                         if (depth == 0)
                         {
+                            //Skip the state if a symmetry of it was already played
+                            if (uniqueOpenings && !playedOpenings.insert(board.getCanonical().first).second) {return;}
+                            
                             //Set the board of the game
                             game.setBoard(board);
                             //Play a game
@@ -448,17 +842,19 @@ namespace othello
                         else
                         {
                             //Iterate over the possible moves
-                            game::Board tmpBoard;
-                            for (std::size_t i = 0; i < board.getPossibleMoves().size(); ++i)
+                            game::bitboard_t possibleMoves = board.getLegalMoves();
+                            while (possibleMoves)
                             {
-                                //Copy the board
-                                tmpBoard = board;
                                 //Make the move
-                                tmpBoard.makeMove(&tmpBoard.getPossibleMoves()[i]);
+                                const game::UndoRecord undo = board.applyMove(
+                                        board.createMove(game::bitboard::popLowest(possibleMoves)));
                         
                                 //Call this function on the possible state
                                 startGamesForPossibleMoves(game, counter,
-                                                           depth - 1, tmpBoard);
+                                                           depth - 1, board);
+                                
+                                //Take the move back
+                                board.undoMove(undo);
                             }
                         }
                     };
@@ -514,6 +910,7 @@ namespace othello
                             //Create a default board
                             game::Board board;
                             //Start games
+                            playedOpenings.clear();
                             startGamesForPossibleMoves(trainingGame, tmpCounter,
                                                        trainingStartFromTurn, board);
                             
@@ -524,6 +921,7 @@ namespace othello
                                 trainingGame.manualSwitchPlayers();
 
                                 //Start games
+                                playedOpenings.clear();
                                 startGamesForPossibleMoves(trainingGame, tmpCounter,
                                                            trainingStartFromTurn, board);
                                 
@@ -585,6 +983,7 @@ namespace othello
                             //Create a default board
                             game::Board board;
                             //Start games
+                            playedOpenings.clear();
                             startGamesForPossibleMoves(testGame, tmpCounter,
                                                        testingStartFromTurn, board);
 
@@ -595,6 +994,7 @@ namespace othello
                                 testGame.manualSwitchPlayers();
     
                                 //Start games
+                                playedOpenings.clear();
                                 startGamesForPossibleMoves(testGame, tmpCounter,
                                                            testingStartFromTurn, board);
     
@@ -616,6 +1016,18 @@ namespace othello
                     std::cout << std::endl;
                     testGame.getStatsManager()->output();
                     testGame.getStatsManager()->nextBatch();
+                    
+                    //Print the work done by the searching players of the test game
+                    //(player 2 is the test player when training)
+                    for (uint8_t j = 0; j < 2; ++j)
+                    {
+                        const game::IPlayer* testPlayer = players[j == 1 && training ? 2 : j].get();
+                        const auto* searcher = dynamic_cast<const ai::AlphaBetaPruningPlayer*>(testPlayer);
+                        if (searcher)
+                        {
+                            std::cout << "Player " << j + 1 << " nodes searched: " << searcher->getNodeCount() << std::endl;
+                        }
+                    }
                     std::cout << std::endl;
                 }
             }
@@ -1,6 +1,14 @@
+//Standard C++:
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <stdexcept>
 //Othello headers:
 #include <othello/ai/AlphaBetaPruningPlayer.hpp>
 #include <othello/ai/MoveEvaluator.hpp>
+#include <othello/game/Bitboard.hpp>
+#include <othello/game/LastEmpties.hpp>
 
 namespace othello
 {
@@ -8,111 +16,596 @@ namespace othello
     namespace ai
     {
     
-        ////////////////////////////////////////////////////////////////
-        int64_t AlphaBetaPruningPlayer::alphaBeta(const game::Board& board, const uint8_t& player, const game::Move& move, uint8_t depth,
-                          int64_t alpha, int64_t beta)
+        namespace
         {
-            //If we've reached the max is depth or this is the last move
-            if (depth == 0 || board.isOver())
+            
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to turn a final disk difference into a
+            ///        value, which is better than any the table can give if
+            ///        the game is won (and worse if it's lost)
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline int64_t getSolvedValue(const int& difference)
             {
-                return ai::MoveEvaluator::evaluate(board, player);
+                if (difference > 0) {return AlphaBetaPruningPlayer::SOLVED_VALUE + difference;}
+                if (difference < 0) {return -AlphaBetaPruningPlayer::SOLVED_VALUE + difference;}
+                return 0;
             }
+            
+        }
+        
         
-            //Whether we're maximising (whether we want the best or worst move)
-            bool maximising = board.getCurrentPlayer() == player;
+        ////////////////////////////////////////////////////////////////
+        constexpr int64_t AlphaBetaPruningPlayer::INFINITE_VALUE;
+        constexpr int64_t AlphaBetaPruningPlayer::SOLVED_VALUE;
         
-            //Create a temporary board
-            game::Board tmpBoard;
-            int64_t value = maximising ? INT64_MIN : INT64_MAX;
         
-            //Iterate over the possible moves
-            for (std::size_t i = 0; i < board.getPossibleMoves().size(); ++i)
+        ////////////////////////////////////////////////////////////////
+        int64_t AlphaBetaPruningPlayer::alphaBeta(game::Board& board, const uint8_t& depth, int64_t alpha, int64_t beta,
+                SearchThread& thread)
+        {
+            //Count the node, and give up if the search was stopped
+            if (++thread.pendingNodes >= NODE_CHECK_INTERVAL) {addNodes(thread.pendingNodes);}
+            if (isStopped(thread)) {return 0;}
+            
+            //Values are from the point of view of the player to move
+            const uint8_t player = board.getCurrentPlayer();
+            
+            //If the search would reach the end of the game from the last few
+            //empty tiles, solve them instead
+            const uint8_t numEmpty = game::bitboard::popCount(board.getEmptyTiles());
+            if (numEmpty <= game::LastEmpties::MAX_EMPTIES && depth >= numEmpty)
+            {
+                ++thread.counters.leaves;
+                return getSolvedValue(game::LastEmpties::solve(board.getPlayerDisks(), board.getOpponentDisks(),
+                                                               -EndgameSolver::MAX_SCORE - 1, EndgameSolver::MAX_SCORE + 1,
+                                                               thread.pendingNodes));
+            }
+            
+            //If the game is over, its value is the final disk difference (which
+            //has to be the same however early the game ended)
+            if (board.isOver())
+            {
+                ++thread.counters.leaves;
+                return getSolvedValue(int(game::bitboard::popCount(board.getPlayerDisks())) -
+                                      int(game::bitboard::popCount(board.getOpponentDisks())));
+            }
+            
+            //If we've reached the max depth
+            if (depth == 0)
+            {
+                ++thread.counters.leaves;
+                return ai::MoveEvaluator::evaluate(board, player);
+            }
+            
+            //Look the position up in the table
+            TranspositionTable::Entry entry;
+            uint8_t bestSquare = TranspositionTable::NO_MOVE;
+            ++thread.counters.tableProbes;
+            if (table.probe(board.getHash(), entry))
+            {
+                ++thread.counters.tableHits;
+                bestSquare = entry.move;
+                
+                //A result at least as deep can be used instead of searching
+                if (entry.depth >= depth)
+                {
+                    if (entry.bound == TranspositionTable::EXACT) {return entry.value;}
+                    if (entry.bound == TranspositionTable::LOWER) {alpha = std::max<int64_t>(alpha, entry.value);}
+                    else {beta = std::min<int64_t>(beta, entry.value);}
+                    if (alpha >= beta) {return entry.value;}
+                }
+            }
+            
+            //With ProbCut, a shallower search predicts if this one would fail high
+            //or low, and the board is pruned if it's sure enough (not with solved
+            //values, as the shallow searches can't predict them)
+            if (probCut.isUsing(depth))
+            {
+                for (uint8_t check = 0; check < ProbCut::NUM_CHECKS; ++check)
+                {
+                    const ProbCut::Parameters& parameters = probCut.getParameters(depth, check);
+                    if (parameters.slope <= 0 || depth < ProbCut::REDUCTIONS[check]) {continue;}
+                    const uint8_t shallowDepth = depth - ProbCut::REDUCTIONS[check];
+                    
+                    if (std::abs(beta) < SOLVED_VALUE / 2)
+                    {
+                        //(A stopped search's value means nothing, so it can't cut)
+                        const int64_t bound = probCut.getHighBound(parameters, beta);
+                        const int64_t value = alphaBeta(board, shallowDepth, bound - 1, bound, thread);
+                        if (isStopped(thread)) {return 0;}
+                        if (value >= bound)
+                        {
+                            ++thread.counters.probCuts;
+                            return beta;
+                        }
+                    }
+                    if (std::abs(alpha) < SOLVED_VALUE / 2)
+                    {
+                        const int64_t bound = probCut.getLowBound(parameters, alpha);
+                        const int64_t value = alphaBeta(board, shallowDepth, bound, bound + 1, thread);
+                        if (isStopped(thread)) {return 0;}
+                        if (value <= bound)
+                        {
+                            ++thread.counters.probCuts;
+                            return alpha;
+                        }
+                    }
+                }
+            }
+            const int64_t alphaOrig = alpha;
+            
+            //The best move found last time, if it's still there
+            const game::bitboard_t legalMoves = board.getLegalMoves();
+            if (bestSquare != TranspositionTable::NO_MOVE && !(legalMoves & game::bitboard::toBit(bestSquare)))
             {
-                //Copy the board
-                tmpBoard = board;
-                //Make the move
-                tmpBoard.makeMove(&tmpBoard.getPossibleMoves()[i]);
+                bestSquare = TranspositionTable::NO_MOVE;
+            }
             
-                //Calculate the alpha beta
-                int64_t ret = alphaBeta(tmpBoard, player, board.getPossibleMoves()[i],
-                                        depth - 1, alpha, beta);
+            //At the last level the children are only evaluated, so if the batch
+            //kernels are vectorised they're all made and evaluated together
+            //(one at a time is faster otherwise, as cutoffs skip some of them)
+            const bool batchLeaves = game::BoardBatch::getVectorWidth() > 1 && depth == 1;
+            thread_local game::BoardBatch batch;
+            int64_t childValues[game::MoveList::MAX_MOVES];
+            uint8_t squares[game::MoveList::MAX_MOVES];
+            std::size_t numMoves = 0;
+            if (batchLeaves)
+            {
+                //(their values are all known, so their order doesn't matter)
+                numMoves = ai::MoveEvaluator::evaluateChildren(board, player, batch, childValues);
+                thread.pendingNodes += numMoves;
+                thread.counters.leaves += numMoves;
                 
-                //If we want to maximise the value
-                if (maximising)
+                //The children that finished the game (which have no legal moves)
+                //are valued like alphaBeta values them
+                for (std::size_t i = 0; i < numMoves; ++i)
+                {
+                    if (batch.getLegalMoves()[i]) {continue;}
+                    const game::Board child = batch.getBoard(i);
+                    childValues[i] = getSolvedValue(int(game::bitboard::popCount(child.getDisks(player))) -
+                                                    int(game::bitboard::popCount(child.getDisks(!player))));
+                }
+                game::bitboard_t moves = legalMoves;
+                for (std::size_t i = 0; moves; ++i) {squares[i] = game::bitboard::popLowest(moves);}
+            }
+            else
+            {
+                //Deep positions with nothing better to go on are ordered by a
+                //shallow search of each child
+                const bool shallow = moveOrderer.shouldSearchShallow(depth, bestSquare);
+                if (shallow)
                 {
-                    value = std::max(value, ret);
-                    alpha = std::max(alpha, value);
+                    const uint8_t shallowDepth = depth - 1 - MoveOrderer::SHALLOW_SEARCH_REDUCTION;
+                    game::bitboard_t moves = legalMoves;
+                    for (std::size_t i = 0; moves; ++i)
+                    {
+                        const game::UndoRecord undo = board.applyMove(board.createMove(game::bitboard::popLowest(moves)));
+                        childValues[i] = searchChild(board, player, shallowDepth, -INFINITE_VALUE, INFINITE_VALUE, thread);
+                        board.undoMove(undo);
+                        if (isStopped(thread)) {return 0;}
+                    }
                 }
-                    //If it's the other player, we want the min
+                numMoves = moveOrderer.orderMoves(board, bestSquare, depth, thread.heuristics,
+                                                  shallow ? childValues : nullptr, squares);
+            }
+            
+            //Iterate over the possible moves, best first
+            int64_t value = -INFINITE_VALUE;
+            for (std::size_t i = 0; i < numMoves; ++i)
+            {
+                const uint8_t square = squares[i];
+                int64_t ret;
+                
+                if (batchLeaves) {ret = childValues[i];}
                 else
                 {
-                    value = std::min(value, ret);
-                    beta = std::min(beta, value);
+                    //Make the move (its flips are only calculated now)
+                    const game::UndoRecord undo = board.applyMove(board.createMove(square));
+                    
+                    //With principal variation search, the moves after the first are
+                    //only searched fully if a zero window search shows they're better
+                    if (algorithm == PVS && i > 0)
+                    {
+                        ret = searchChild(board, player, depth - 1, alpha, alpha + 1, thread);
+                        if (ret > alpha && ret < beta) {ret = searchChild(board, player, depth - 1, alpha, beta, thread);}
+                    }
+                    else {ret = searchChild(board, player, depth - 1, alpha, beta, thread);}
+                    
+                    //Take the move back
+                    board.undoMove(undo);
+                    
+                    //The value is garbage if the search was stopped
+                    if (isStopped(thread)) {return 0;}
+                }
+                
+                if (ret > value)
+                {
+                    value = ret;
+                    bestSquare = square;
                 }
+                alpha = std::max(alpha, value);
+                
                 //If the alpha is larger than the beta, break out of the loop
-                if (alpha >= beta) {break;}
+                //(remembering the move that caused it)
+                if (alpha >= beta)
+                {
+                    if (!batchLeaves) {thread.heuristics.addCutoff(player, square, depth);}
+                    ++thread.counters.cutoffs;
+                    if (i == 0) {++thread.counters.firstMoveCutoffs;}
+                    break;
+                }
             }
+            
+            //Store the result, as a bound if it's outside the window
+            TranspositionTable::Bound bound = TranspositionTable::EXACT;
+            if (value <= alphaOrig) {bound = TranspositionTable::UPPER;}
+            else if (value >= beta) {bound = TranspositionTable::LOWER;}
+            table.store(board.getHash(), static_cast<int32_t>(value), depth, bound, bestSquare);
+            ++thread.counters.tableStores;
+            
             return value;
         }
-    
+        
         
         ////////////////////////////////////////////////////////////////
-        const game::Move* AlphaBetaPruningPlayer::makeMove(const game::Game& game, const uint8_t& player,
-                const std::vector<game::Move>& possibleMoves)
+        int64_t AlphaBetaPruningPlayer::searchChild(game::Board& board, const uint8_t& player, const uint8_t& depth,
+                const int64_t& alpha, const int64_t& beta, SearchThread& thread)
+        {
+            //The player moves again if the other player has to pass
+            if (board.getCurrentPlayer() == player) {return alphaBeta(board, depth, alpha, beta, thread);}
+            return -alphaBeta(board, depth, -beta, -alpha, thread);
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        int64_t AlphaBetaPruningPlayer::mtdf(game::Board& board, const uint8_t& depth, const int64_t& alpha,
+                const int64_t& beta, SearchThread& thread)
         {
-            //Create a vector of the future move values
-            std::vector<util::FutureValue<int64_t> > futureValues;
+            //Start from the value in the table if there is one (it's likely to be
+            //from the last iteration), or else the board's value
+            TranspositionTable::Entry entry;
+            ++thread.counters.tableProbes;
+            const bool hit = table.probe(board.getHash(), entry);
+            thread.counters.tableHits += hit;
+            int64_t value = hit ? entry.value : MoveEvaluator::evaluate(board, board.getCurrentPlayer());
+            value = std::max(alpha, std::min(beta, value));
             
-            //Iterate over the possible moves
-            game::Board tmpBoard;
-            for (std::size_t i = 0; i < game.getBoard().getPossibleMoves().size(); ++i)
+            //Narrow the bounds of the value with zero window searches, until they
+            //meet or the value is known to be outside the window
+            int64_t lower = -INFINITE_VALUE;
+            int64_t upper = INFINITE_VALUE;
+            while (lower < upper && upper > alpha && lower < beta)
             {
-                //Copy the board
-                tmpBoard = game.getBoard();
-                //Make the move
-                tmpBoard.makeMove(&tmpBoard.getPossibleMoves()[i]);
+                //(the window is (test - 1, test), so a value of test fails high)
+                const int64_t test = value == lower ? value + 1 : value;
+                value = alphaBeta(board, depth, test - 1, test, thread);
+                if (isStopped(thread)) {return 0;}
                 
-                //If the worker manager has a worker available
-                if (workerManager.hasAvailableWorker())
+                if (value < test) {upper = value;}
+                else {lower = value;}
+            }
+            return value;
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        AlphaBetaPruningPlayer::SearchThread& AlphaBetaPruningPlayer::getSearchThread(const bool& helper)
+        {
+            //Get this thread's state, which is reset for each search
+            thread_local SearchThread thread;
+            if (thread.player != this || thread.searchNumber != searchNumber)
+            {
+                thread.player = this;
+                thread.searchNumber = searchNumber;
+                thread.heuristics.newSearch();
+            }
+            thread.helper = helper;
+            return thread;
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        int64_t AlphaBetaPruningPlayer::searchRootMove(game::Board& board, const uint8_t& player, const uint8_t& depth,
+                const int64_t& alpha, const int64_t& beta)
+        {
+            SearchThread& thread = getSearchThread(false);
+            
+            int64_t value;
+            if (algorithm != MTDF) {value = searchChild(board, player, depth, alpha, beta, thread);}
+            else if (board.getCurrentPlayer() == player) {value = mtdf(board, depth, alpha, beta, thread);}
+            else {value = -mtdf(board, depth, -beta, -alpha, thread);}
+            
+            addNodes(thread.pendingNodes);
+            addCounters(thread.counters);
+            return value;
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        int64_t AlphaBetaPruningPlayer::helpSearch(game::Board& board, const uint8_t& player, uint8_t depth,
+                int64_t beta, std::size_t helper)
+        {
+            SearchThread& thread = getSearchThread(true);
+            
+            //Get the root moves
+            uint8_t squares[game::MoveList::MAX_MOVES];
+            std::size_t numMoves = 0;
+            for (game::bitboard_t moves = board.getLegalMoves(); moves; ++numMoves)
+            {
+                squares[numMoves] = game::bitboard::popLowest(moves);
+            }
+            
+            //Each helper starts on a different move and every other one searches a
+            //ply deeper, so the threads are rarely in the same part of the tree.
+            //Helpers go deeper until they're stopped, and only their table entries
+            //are used
+            for (uint8_t d = depth + helper % 2; d <= MoveOrderer::MAX_DEPTH && !isStopped(thread); ++d)
+            {
+                for (std::size_t i = 0; i < numMoves && !isStopped(thread); ++i)
                 {
-                    //Tell the worker to start and then add the future value to the vector
-                    futureValues.emplace_back(
-                            workerManager.startWork(
-                                    tmpBoard, player, game.getBoard().getPossibleMoves()[i],
-                                    searchDepth, INT64_MIN, INT64_MAX));
+                    const game::UndoRecord undo = board.applyMove(board.createMove(squares[(helper + 1 + i) % numMoves]));
+                    searchChild(board, player, d, rootAlpha.load(std::memory_order_relaxed), beta, thread);
+                    board.undoMove(undo);
                 }
-                else
+            }
+            
+            addNodes(thread.pendingNodes);
+            addCounters(thread.counters);
+            return 0;
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        void AlphaBetaPruningPlayer::addNodes(uint64_t& pendingNodes)
+        {
+            const uint64_t total = nodes.fetch_add(pendingNodes, std::memory_order_relaxed) + pendingNodes;
+            pendingNodes = 0;
+            
+            //The search is only stopped once a move can be picked
+            if (!hasResult) {return;}
+            if ((nodesPerMove && total >= nodesPerMove) ||
+                (timePerMove.count() && std::chrono::steady_clock::now() >= deadline))
+            {
+                stopped.store(true, std::memory_order_relaxed);
+            }
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        void AlphaBetaPruningPlayer::addCounters(SearchStatistics::Counters& counters)
+        {
+            //(only the nodes searched on the opponent's time are kept)
+            std::lock_guard<std::mutex> lock(statisticsMutex);
+            if (!pondering) {statistics.counters += counters;}
+            counters = SearchStatistics::Counters();
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        bool AlphaBetaPruningPlayer::searchRootMoves(game::Board& board, const uint8_t& player,
+                const game::MoveList& possibleMoves, const std::vector<std::size_t>& order, const uint8_t& depth,
+                const int64_t& alpha, const int64_t& beta, const std::vector<bool>& searching,
+                std::vector<int64_t>& values)
+        {
+            //Start every worker on a helper search
+            rootAlpha = alpha;
+            if (depth >= MIN_HELPER_DEPTH) {startHelpers(board, player, depth, beta);}
+            
+            //Search the moves in order on one copy of the board
+            int64_t best = INT64_MIN;
+            for (const std::size_t& i : order)
+            {
+                if (!searching[i]) {continue;}
+                
+                //Make the move, search it and take it back
+                const auto start = std::chrono::steady_clock::now();
+                const game::UndoRecord undo = board.applyMove(possibleMoves[i]);
+                values[i] = searchRootMove(board, player, depth, rootAlpha.load(std::memory_order_relaxed), beta);
+                board.undoMove(undo);
+                statistics.rootMoves[i].seconds +=
+                        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                if (stopped.load(std::memory_order_relaxed)) {break;}
+                
+                //Moves too far below the best can't be picked, so only their bounds
+                //are needed
+                if (values[i] > best)
                 {
-                    //Work on it in this thread and then place the value in the vector
-                    futureValues.emplace_back(alphaBeta(tmpBoard, player, game.getBoard().getPossibleMoves()[i],
-                                                        searchDepth,INT64_MIN, INT64_MAX));
+                    best = values[i];
+                    rootAlpha = std::max(alpha, best - BEST_MOVE_RANGE - 1);
                 }
             }
+            const bool finished = !stopped.load(std::memory_order_relaxed);
+            
+            stopHelpers();
+            return finished;
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        void AlphaBetaPruningPlayer::startHelpers(game::Board& board, const uint8_t& player, const uint8_t& depth,
+                const int64_t& beta)
+        {
+            //(the workers copy the board they're given)
+            helpersStopped = false;
+            const auto lock = workerManager.lock();
+            for (std::size_t helper = 0; workerManager.hasAvailableWorker(); ++helper)
+            {
+                helperResults.push_back(workerManager.startWork(board, player, depth, beta, helper));
+            }
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        void AlphaBetaPruningPlayer::stopHelpers()
+        {
+            //Block until every helper has finished, instead of polling the workers
+            helpersStopped = true;
+            for (const util::FutureValue<int64_t>& result : helperResults) {result.wait();}
+            helperResults.clear();
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        bool AlphaBetaPruningPlayer::searchIteration(game::Board& board, const uint8_t& player,
+                const game::MoveList& possibleMoves, const uint8_t& depth, const int64_t& previousBest,
+                std::vector<int64_t>& values)
+        {
+            //Search every move in a window around the last best value, wide enough
+            //below it for every move that could be picked if the value doesn't change
+            //(the first iteration has nothing to go on)
+            const bool aspiration = previousBest != INT64_MIN;
+            const int64_t low = aspiration ? previousBest - BEST_MOVE_RANGE - ASPIRATION_WINDOW : -INFINITE_VALUE;
+            const int64_t high = aspiration ? previousBest + ASPIRATION_WINDOW : INFINITE_VALUE;
+            std::vector<bool> searching(possibleMoves.size(), true);
+            
+            //Search the moves that were best last time first, so the window can be
+            //narrowed sooner (values holds the last iteration's values)
+            std::vector<std::size_t> order(possibleMoves.size());
+            for (std::size_t i = 0; i < order.size(); ++i) {order[i] = i;}
+            if (aspiration)
+            {
+                std::stable_sort(order.begin(), order.end(),
+                                 [&values](const std::size_t& a, const std::size_t& b) {return values[a] > values[b];});
+            }
+            
+            if (!searchRootMoves(board, player, possibleMoves, order, depth, low, high, searching, values)) {return false;}
+            if (!aspiration) {return true;}
+            
+            //Search the moves that failed high again with the full window
+            bool researching = false;
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                searching[i] = values[i] >= high;
+                researching |= searching[i];
+            }
+            if (researching &&
+                !searchRootMoves(board, player, possibleMoves, order, depth, -INFINITE_VALUE, INFINITE_VALUE, searching, values))
+            {
+                return false;
+            }
+            
+            //Find the best move that didn't fail low (if any)
+            int64_t best = INT64_MIN;
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                if (searching[i] || values[i] > low) {best = std::max(best, values[i]);}
+            }
+            
+            //Moves that failed low are only searched again if they could be picked
+            //(their values are at most low, and only the exact values matter)
+            researching = false;
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                searching[i] = !searching[i] && values[i] <= low && (best == INT64_MIN || low >= best - BEST_MOVE_RANGE);
+                researching |= searching[i];
+            }
+            return !researching ||
+                   searchRootMoves(board, player, possibleMoves, order, depth, -INFINITE_VALUE, INFINITE_VALUE, searching, values);
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        AlphaBetaPruningPlayer::~AlphaBetaPruningPlayer() {stopPondering();}
+        
+        
+        ////////////////////////////////////////////////////////////////
+        const game::Move* AlphaBetaPruningPlayer::makeMove(const game::Game& game, const uint8_t& player,
+                const game::MoveList& possibleMoves)
+        {
+            //Stop searching on the opponent's time (what it found is in the table)
+            const uint64_t ponderNodes = stopPondering();
+            
+            //Start the budget
+            const auto start = std::chrono::steady_clock::now();
+            deadline = start + timePerMove;
+            hasResult = false;
+            stopped = false;
+            nodes = 0;
+            
+            //Older results are replaced first
+            table.newSearch();
+            ++searchNumber;
+            
+            //Start the statistics
+            statistics = SearchStatistics();
+            statistics.ponderNodes = ponderNodes;
+            for (const game::Move& move : possibleMoves) {statistics.rootMoves.push_back({move.square, 0});}
+            
+            //Play from the opening book if the board is in it
+            if (book)
+            {
+                if (const game::Move* move = bookMove(game.getBoard(), possibleMoves))
+                {
+                    statistics.book = true;
+                    statistics.rootMoves.clear();
+                    finishStatistics(start);
+                    startPondering(game.getBoard(), *move);
+                    return move;
+                }
+            }
+            
+            //Play a best move if the game can be solved in time (or else search it
+            //with the rest of the budget)
+            if (game::bitboard::popCount(game.getBoard().getEmptyTiles()) <= endgameEmpties)
+            {
+                if (const game::Move* move = solveMove(game.getBoard(), possibleMoves))
+                {
+                    statistics.rootMoves.clear();
+                    finishStatistics(start);
+                    startPondering(game.getBoard(), *move);
+                    return move;
+                }
+            }
+            
+            //Searching past the end of the game changes nothing
+            game::Board tmpBoard = game.getBoard();
+            const unsigned int maxDepth = std::min<unsigned int>(
+                    std::max(searchDepth, 1u), game::bitboard::popCount(tmpBoard.getEmptyTiles()));
+            
+            //Search one ply deeper each time, keeping the values of the last search
+            //that finished
+            std::vector<int64_t> values(possibleMoves.size());
+            std::vector<int64_t> iterationValues(possibleMoves.size());
+            int64_t bestMoveValue = INT64_MIN;
+            for (unsigned int depth = 1; depth <= maxDepth; ++depth)
+            {
+                const auto iterationStart = std::chrono::steady_clock::now();
+                const uint64_t iterationNodes = nodes;
+                const bool finished = searchIteration(tmpBoard, player, possibleMoves, static_cast<uint8_t>(depth),
+                                                      bestMoveValue, iterationValues);
+                statistics.iterations.push_back({static_cast<uint8_t>(depth), nodes - iterationNodes,
+                        std::chrono::duration<double>(std::chrono::steady_clock::now() - iterationStart).count(),
+                        finished});
+                if (!finished) {break;}
+                statistics.depth = static_cast<uint8_t>(depth);
+                values = iterationValues;
+                bestMoveValue = *std::max_element(values.begin(), values.end());
+                hasResult = true;
+                
+                //Don't start a search that would likely run out of time or nodes
+                //(each ply takes a few times longer than the last)
+                if (timePerMove.count() && std::chrono::steady_clock::now() >= deadline - timePerMove / 2) {break;}
+                if (nodesPerMove && nodes >= nodesPerMove) {break;}
+            }
     
+            totalNodes += nodes;
+            statistics.nodes = nodes;
+            finishStatistics(start);
+            
             //A map of move indexes with the associated move value as the key
             //(the index being the key means the data is automatically sorted)
             std::map<int64_t, std::size_t> movesAndValues;
-            
-            //Iterate over the future values
-            for (std::size_t i = 0; i < futureValues.size(); ++i)
-            {
-                //Wait for the value if it isn't here yet
-                futureValues[i].wait();
-                //Add the value to the map
-                movesAndValues.emplace(futureValues[i].get(), i);
-            }
+            for (std::size_t i = 0; i < values.size(); ++i) {movesAndValues.emplace(values[i], i);}
     
             //Create a vector of the best moves
             std::vector<std::size_t> bestMoves;
-    
-            //Get the best move value
-            int64_t bestMoveValue = movesAndValues.rbegin()->first;
             
             //Iterate over the sorted moves backwards
             for (auto it = movesAndValues.rbegin(); it != movesAndValues.rend(); ++it)
             {
-                //If the value is within 20 "points" of the best value
-                if (bestMoveValue - it->first <= 20)
+                //If the value is close enough to the best value
+                if (bestMoveValue - it->first <= BEST_MOVE_RANGE)
                 {
                     //Add the move
                     bestMoves.emplace_back(it->second);
@@ -123,9 +616,201 @@ namespace othello
             
             //Pick a random move from the best moves
             boost::random::uniform_int_distribution<> distribution(0, bestMoves.size() - 1);
+            const game::Move* move = &possibleMoves[bestMoves[distribution(randomNumberGenerator)]];
+            startPondering(game.getBoard(), *move);
+            return move;
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        int64_t AlphaBetaPruningPlayer::search(const game::Board& board, const uint8_t& depth)
+        {
+            //There's no budget, so the search is never stopped
+            stopPondering();
+            hasResult = false;
+            stopped = false;
+            nodes = 0;
+            ++searchNumber;
+            
+            game::Board tmpBoard = board;
+            SearchThread& thread = getSearchThread(false);
+            const int64_t value = algorithm == MTDF ? mtdf(tmpBoard, depth, -INFINITE_VALUE, INFINITE_VALUE, thread) :
+                                  alphaBeta(tmpBoard, depth, -INFINITE_VALUE, INFINITE_VALUE, thread);
+            addNodes(thread.pendingNodes);
+            addCounters(thread.counters);
+            totalNodes += nodes;
+            return value;
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        const game::Move* AlphaBetaPruningPlayer::bookMove(const game::Board& board,
+                const game::MoveList& possibleMoves)
+        {
+            OpeningBook::Entry entry;
+            if (!book->probe(board, entry) || entry.move == OpeningBook::NO_MOVE) {return nullptr;}
+            
+            //Value each move by the board after it (which doesn't negate passes)
+            std::vector<int64_t> values;
+            for (const game::Move& move : possibleMoves)
+            {
+                game::Board tmpBoard = board;
+                tmpBoard.applyMove(move);
+                OpeningBook::Entry childEntry;
+                if (!book->probe(tmpBoard, childEntry)) {break;}
+                values.push_back(tmpBoard.getCurrentPlayer() == board.getCurrentPlayer() ?
+                                 childEntry.value : -childEntry.value);
+            }
+            
+            //Play the board's best move if a move is missing
+            if (values.size() < possibleMoves.size())
+            {
+                for (const game::Move& move : possibleMoves)
+                {
+                    if (move.square == entry.move) {return &move;}
+                }
+                return nullptr;
+            }
+            
+            //Pick a random move from the best moves
+            const int64_t bestMoveValue = *std::max_element(values.begin(), values.end());
+            std::vector<std::size_t> bestMoves;
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                if (bestMoveValue - values[i] <= BEST_MOVE_RANGE) {bestMoves.push_back(i);}
+            }
+            boost::random::uniform_int_distribution<> distribution(0, bestMoves.size() - 1);
             return &possibleMoves[bestMoves[distribution(randomNumberGenerator)]];
         }
         
+        
+        ////////////////////////////////////////////////////////////////
+        const game::Move* AlphaBetaPruningPlayer::solveMove(const game::Board& board,
+                const game::MoveList& possibleMoves)
+        {
+            //Solve the game with a quarter of the budget, so there's time to search
+            //it if the solve runs out (iterations aren't started after half of it)
+            solver.setBudget(timePerMove / 4, nodesPerMove ? std::max<uint64_t>(nodesPerMove / 4, 1) : 0);
+            std::vector<uint8_t> bestSquares;
+            const uint64_t solverNodes = solver.getNodeCount();
+            solver.solve(board, endgameMode, bestSquares);
+            
+            //The nodes of an aborted solve count towards the search's budget
+            if (solver.isAborted())
+            {
+                nodes = solver.getNodeCount() - solverNodes;
+                return nullptr;
+            }
+            totalNodes += solver.getNodeCount() - solverNodes;
+            statistics.nodes = solver.getNodeCount() - solverNodes;
+            statistics.solved = true;
+            
+            //Pick a random move from the best moves
+            boost::random::uniform_int_distribution<> distribution(0, bestSquares.size() - 1);
+            const uint8_t square = bestSquares[distribution(randomNumberGenerator)];
+            for (const game::Move& move : possibleMoves)
+            {
+                if (move.square == square) {return &move;}
+            }
+            return &possibleMoves[0];
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        void AlphaBetaPruningPlayer::finishStatistics(const std::chrono::steady_clock::time_point& start)
+        {
+            statistics.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (logStatistics) {statistics.print(std::cout);}
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        void AlphaBetaPruningPlayer::startPondering(const game::Board& board, const game::Move& move)
+        {
+            //The opponent's replies are only searched if the position after them
+            //won't be solved
+            game::Board ponderBoard = board;
+            ponderBoard.applyMove(move);
+            const auto lock = workerManager.lock();
+            if (!ponder || !workerManager.hasAvailableWorker() || ponderBoard.isOver() ||
+                game::bitboard::popCount(ponderBoard.getEmptyTiles()) <= endgameEmpties + 1u)
+            {
+                return;
+            }
+            
+            //The reply the search expects (the best move the table has for the
+            //board) is likely to be played, so its board is searched as the next
+            //root would be
+            game::Board expectedBoard = ponderBoard;
+            TranspositionTable::Entry entry;
+            const bool expected = table.probe(ponderBoard.getHash(), entry) && entry.move != TranspositionTable::NO_MOVE &&
+                                  (ponderBoard.getLegalMoves() & game::bitboard::toBit(entry.move));
+            if (expected) {expectedBoard.applyMove(expectedBoard.createMove(entry.move));}
+            
+            //The first helper searches the expected reply and the rest search every
+            //reply, as if the board was the root with the full window (they're
+            //only stopped by stopPondering, as there's no result yet)
+            table.newSearch();
+            ++searchNumber;
+            hasResult = false;
+            stopped = false;
+            nodes = 0;
+            rootAlpha = -INFINITE_VALUE;
+            helpersStopped = false;
+            pondering = true;
+            for (std::size_t helper = 0; workerManager.hasAvailableWorker(); ++helper)
+            {
+                game::Board& root = helper == 0 && expected && !expectedBoard.isOver() ? expectedBoard : ponderBoard;
+                helperResults.push_back(workerManager.startWork(root, root.getCurrentPlayer(), 1, INFINITE_VALUE,
+                                                                helper));
+            }
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        uint64_t AlphaBetaPruningPlayer::stopPondering()
+        {
+            if (!pondering) {return 0;}
+            
+            stopHelpers();
+            pondering = false;
+            return nodes;
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        void AlphaBetaPruningPlayer::gameFinished(const game::Game&, const uint8_t&) {stopPondering();}
+        
+        
+        ////////////////////////////////////////////////////////////////
+        void AlphaBetaPruningPlayer::enablePondering(bool ponder)
+        {
+            this->ponder = ponder;
+            if (!ponder) {stopPondering();}
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        std::string AlphaBetaPruningPlayer::toString(const Algorithm& algorithm)
+        {
+            switch (algorithm)
+            {
+                case PVS: return "pvs";
+                case MTDF: return "mtdf";
+                default: return "alpha-beta";
+            }
+        }
+        
+        
+        ////////////////////////////////////////////////////////////////
+        AlphaBetaPruningPlayer::Algorithm AlphaBetaPruningPlayer::algorithmFromString(const std::string& str)
+        {
+            if (str == "alpha-beta") {return ALPHA_BETA;}
+            if (str == "pvs") {return PVS;}
+            if (str == "mtdf") {return MTDF;}
+            throw std::invalid_argument("Unknown search algorithm '" + str + "'");
+        }
+        
     }
     
 }
\ No newline at end of file
@@ -0,0 +1,255 @@
+//Standard C++:
+#include <algorithm>
+#include <stdexcept>
+//Othello headers:
+#include <othello/ai/EndgameSolver.hpp>
+#include <othello/game/LastEmpties.hpp>
+#include <othello/game/MoveGenerator.hpp>
+#include <othello/game/PositionFeatures.hpp>
+#include <othello/game/Stability.hpp>
+
+
+namespace othello
+{
+
+    namespace ai
+    {
+
+        namespace
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get a player's final disk difference
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline int getDiskDifference(const game::Board& board, const uint8_t& player)
+            {
+                return int(game::bitboard::popCount(board.getDisks(player))) -
+                       int(game::bitboard::popCount(board.getDisks(!player)));
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The scores given for ordering the moves, so the
+            ///        table's move goes first and parity only breaks ties
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr int TABLE_MOVE_SCORE = 1 << 20u;
+            constexpr unsigned int FASTEST_FIRST_SHIFT = 1;
+            constexpr int PARITY_SCORE = 1;
+
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        constexpr int EndgameSolver::MAX_SCORE;
+        constexpr game::hash_t EndgameSolver::TABLE_KEY;
+        constexpr uint64_t EndgameSolver::NODE_CHECK_INTERVAL;
+
+
+        ////////////////////////////////////////////////////////////////
+        int EndgameSolver::search(game::Board& board, int alpha, int beta)
+        {
+            //The last few empty tiles are solved without the board
+            const uint8_t numEmpty = game::bitboard::popCount(board.getEmptyTiles());
+            if (numEmpty <= game::LastEmpties::MAX_EMPTIES)
+            {
+                return game::LastEmpties::solve(board.getPlayerDisks(), board.getOpponentDisks(), alpha, beta, nodes);
+            }
+            ++nodes;
+            if (isOverBudget()) {return 0;}
+
+            //Values are from the point of view of the player to move
+            const uint8_t player = board.getCurrentPlayer();
+            if (board.isOver()) {return getDiskDifference(board, player);}
+
+            //The stable disks of each player are theirs at the end
+            if (numEmpty >= STABILITY_EMPTIES)
+            {
+                const int upper = game::Stability::getScoreUpperBound(board, player);
+                if (upper <= alpha) {return upper;}
+                const int lower = game::Stability::getScoreLowerBound(board, player);
+                if (lower >= beta) {return lower;}
+                alpha = std::max(alpha, lower - 1);
+                beta = std::min(beta, upper + 1);
+            }
+
+            //Look the position up in the table
+            const game::hash_t key = board.getHash() ^ TABLE_KEY;
+            const bool useTable = table && numEmpty >= TABLE_EMPTIES;
+            uint8_t tableMove = TranspositionTable::NO_MOVE;
+            TranspositionTable::Entry entry;
+            if (useTable && table->probe(key, entry))
+            {
+                //(every solved entry is searched to the end, whatever its depth)
+                if (entry.bound == TranspositionTable::EXACT) {return entry.value;}
+                if (entry.bound == TranspositionTable::LOWER) {alpha = std::max<int>(alpha, entry.value);}
+                else {beta = std::min<int>(beta, entry.value);}
+                if (alpha >= beta) {return entry.value;}
+                tableMove = entry.move;
+            }
+            const int alphaOrig = alpha;
+
+            //Moving into a quadrant with an odd number of empty tiles leaves the
+            //last move there to this player
+            const uint8_t parity = game::PositionFeatures::getParity(board);
+            game::bitboard_t oddTiles = 0;
+            for (uint8_t q = 0; q < 4; ++q)
+            {
+                if (parity & (1u << q)) {oddTiles |= game::PositionFeatures::QUADRANTS[q];}
+            }
+
+            //Score the moves
+            game::Move moves[game::MoveList::MAX_MOVES];
+            int scores[game::MoveList::MAX_MOVES];
+            std::size_t count = 0;
+            for (game::bitboard_t legal = board.getLegalMoves(); legal; ++count)
+            {
+                moves[count] = board.createMove(game::bitboard::popLowest(legal));
+                const uint8_t& square = moves[count].square;
+                int score = 0;
+
+                if (square == tableMove) {score += TABLE_MOVE_SCORE;}
+                if (numEmpty > PARITY_EMPTIES)
+                {
+                    //Fewest moves for the opponent first
+                    const game::bitboard_t bit = game::bitboard::toBit(square);
+                    const game::bitboard_t flips = moves[count].flips;
+                    const game::bitboard_t opponentMoves = game::MoveGenerator::getLegalMoves(
+                            board.getOpponentDisks() & ~flips, board.getPlayerDisks() | flips | bit);
+                    score -= int(game::bitboard::popCount(opponentMoves)) << FASTEST_FIRST_SHIFT;
+                }
+                if (oddTiles & game::bitboard::toBit(square)) {score += PARITY_SCORE;}
+                scores[count] = score;
+            }
+
+            //Sort the moves by score with an insertion sort (stable, so ties
+            //stay in tile order)
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                const game::Move move = moves[i];
+                const int score = scores[i];
+                std::size_t j = i;
+                for (; j > 0 && scores[j - 1] < score; --j)
+                {
+                    moves[j] = moves[j - 1];
+                    scores[j] = scores[j - 1];
+                }
+                moves[j] = move;
+                scores[j] = score;
+            }
+
+            //Search the moves
+            int best = -MAX_SCORE - 1;
+            uint8_t bestSquare = TranspositionTable::NO_MOVE;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const game::UndoRecord undo = board.applyMove(moves[i]);
+                const int value = board.getCurrentPlayer() == player ? search(board, alpha, beta)
+                                                                     : -search(board, -beta, -alpha);
+                board.undoMove(undo);
+                if (aborted) {return 0;}
+
+                if (value > best)
+                {
+                    best = value;
+                    bestSquare = moves[i].square;
+                    if (value > alpha) {alpha = value;}
+                    if (alpha >= beta) {break;}
+                }
+            }
+
+            //Store the result
+            if (useTable)
+            {
+                TranspositionTable::Bound bound = TranspositionTable::EXACT;
+                if (best <= alphaOrig) {bound = TranspositionTable::UPPER;}
+                else if (best >= beta) {bound = TranspositionTable::LOWER;}
+                table->store(key, best, numEmpty, bound, bestSquare);
+            }
+            return best;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        int EndgameSolver::solve(const game::Board& board, const Mode& mode, std::vector<uint8_t>& bestSquares)
+        {
+            game::Board tmpBoard = board;
+            const uint8_t player = board.getCurrentPlayer();
+            bestSquares.clear();
+
+            //Start the budget
+            deadline = std::chrono::steady_clock::now() + timeLimit;
+            lastNode = nodes + nodeLimit;
+            nextCheck = nodes + NODE_CHECK_INTERVAL;
+            aborted = false;
+
+            //In WLD mode only the sign of the result matters
+            const int low = mode == WLD ? -1 : -MAX_SCORE - 1;
+            const int high = mode == WLD ? 1 : MAX_SCORE + 1;
+            auto getResult = [&mode](const int& value) {return mode == WLD ? (value > 0) - (value < 0) : value;};
+
+            //Search each move with a window just below the best result so far,
+            //so moves that are as good get their result and worse ones fail low
+            std::vector<std::pair<uint8_t, int> > results;
+            int best = low;
+            for (game::bitboard_t legal = board.getLegalMoves(); legal;)
+            {
+                const uint8_t square = game::bitboard::popLowest(legal);
+                const int alpha = std::max(low, results.empty() ? low : best - 1);
+                const game::UndoRecord undo = tmpBoard.applyMove(tmpBoard.createMove(square));
+                const int value = tmpBoard.getCurrentPlayer() == player ? search(tmpBoard, alpha, high)
+                                                                        : -search(tmpBoard, -high, -alpha);
+                tmpBoard.undoMove(undo);
+                if (aborted) {return 0;}
+
+                results.emplace_back(square, getResult(std::max(low, std::min(high, value))));
+                if (results.size() == 1 || results.back().second > best) {best = results.back().second;}
+            }
+
+            for (const auto& result : results)
+            {
+                if (result.second == best) {bestSquares.push_back(result.first);}
+            }
+            return best;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void EndgameSolver::setBudget(const std::chrono::milliseconds& timeLimit, const uint64_t& nodeLimit)
+        {
+            this->timeLimit = timeLimit;
+            this->nodeLimit = nodeLimit;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        bool EndgameSolver::isOverBudget()
+        {
+            //(the clock is only read every so many nodes, as it's slow)
+            if (aborted || nodes < nextCheck) {return aborted;}
+            nextCheck = nodes + NODE_CHECK_INTERVAL;
+            aborted = (nodeLimit && nodes >= lastNode) ||
+                      (timeLimit.count() && std::chrono::steady_clock::now() >= deadline);
+            return aborted;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        std::string EndgameSolver::toString(const Mode& mode)
+        {
+            return mode == WLD ? "wld" : "exact";
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        EndgameSolver::Mode EndgameSolver::modeFromString(const std::string& str)
+        {
+            if (str == "exact") {return EXACT;}
+            if (str == "wld") {return WLD;}
+            throw std::invalid_argument("Unknown endgame mode '" + str + "'");
+        }
+
+    }
+
+}
@@ -8,6 +8,58 @@ namespace othello
     namespace ai
     {
     
+        namespace
+        {
+            
+            ////////////////////////////////////////////////////////////////
+            /// \struct WeightGroups
+            ///
+            /// \brief Struct containing the tiles of the table grouped by
+            ///        their value
+            ///
+            ////////////////////////////////////////////////////////////////
+            struct WeightGroups
+            {
+                game::bitboard_t masks[game::Board::BOARD_SIZE * game::Board::BOARD_SIZE];
+                int64_t weights[game::Board::BOARD_SIZE * game::Board::BOARD_SIZE];
+                std::size_t count;
+            };
+            
+            
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to group the tiles of a table by their value
+            ///        at compile time
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr WeightGroups makeWeightGroups(const int (&table)[game::Board::BOARD_SIZE][game::Board::BOARD_SIZE])
+            {
+                WeightGroups groups{};
+                
+                for (uint8_t y = 0; y < game::Board::BOARD_SIZE; ++y)
+                {
+                    for (uint8_t x = 0; x < game::Board::BOARD_SIZE; ++x)
+                    {
+                        //Tiles worth nothing don't need a group
+                        if (table[y][x] == 0) {continue;}
+                        
+                        //Find the tile's group, or add a new one
+                        std::size_t g = 0;
+                        while (g < groups.count && groups.weights[g] != table[y][x]) {++g;}
+                        if (g == groups.count)
+                        {
+                            groups.weights[g] = table[y][x];
+                            ++groups.count;
+                        }
+                        groups.masks[g] |= game::bitboard::toBit(game::bitboard::toIndex({x, y}));
+                    }
+                }
+                
+                return groups;
+            }
+            
+        }
+        
+        
         ////////////////////////////////////////////////////////////////
         constexpr int MoveEvaluator::table[game::Board::BOARD_SIZE][game::Board::BOARD_SIZE];
         
@@ -18,22 +70,45 @@ namespace othello
             //The value of the board
             int64_t value = 0;
             
-            //Calculate the value
-            for (uint8_t y = 0; y < game::Board::BOARD_SIZE; ++y)
+            //Add the value of the player's disks
+            game::bitboard_t disks = board.getDisks(player);
+            while (disks)
             {
-                for (uint8_t x = 0; x < game::Board::BOARD_SIZE; ++x)
-                {
-                    if (board.getTile({x, y}).isClaimed)
-                    {
-                        int8_t c = board.getTile({x, y}).claimant == player ? 1 : -1;
-                        value += table[y][x] * c;
-                    }
-                }
+                const game::TilePosition position = game::bitboard::toPosition(game::bitboard::popLowest(disks));
+                value += table[position.y][position.x];
+            }
+            
+            //Subtract the value of the other player's disks
+            disks = board.getDisks(!player);
+            while (disks)
+            {
+                const game::TilePosition position = game::bitboard::toPosition(game::bitboard::popLowest(disks));
+                value -= table[position.y][position.x];
             }
             
             return value;
         }
     
+    
+        ////////////////////////////////////////////////////////////////
+        void MoveEvaluator::evaluate(const game::BoardBatch& batch, const uint8_t& player, int64_t* values)
+        {
+            static constexpr WeightGroups groups = makeWeightGroups(table);
+            batch.getWeightedDiskCounts(player, groups.masks, groups.weights, groups.count, values);
+        }
+    
+    
+        ////////////////////////////////////////////////////////////////
+        std::size_t MoveEvaluator::evaluateChildren(const game::Board& board, const uint8_t& player,
+                game::BoardBatch& batch, int64_t* values)
+        {
+            //Make every move, then value the children together
+            batch.clear();
+            batch.addChildren(board);
+            evaluate(batch, player, values);
+            return batch.size();
+        }
+    
     }
     
 }
\ No newline at end of file
@@ -0,0 +1,216 @@
+//Standard C++:
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+//Othello headers:
+#include <othello/ai/MoveOrderer.hpp>
+#include <othello/ai/TranspositionTable.hpp>
+#include <othello/game/MoveGenerator.hpp>
+
+
+namespace othello
+{
+
+    namespace ai
+    {
+
+        namespace
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get a bitboard of the tiles a distance in
+            ///        from each corner, diagonally
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr game::bitboard_t makeDiagonalRing(const uint8_t& distance)
+            {
+                constexpr uint8_t last = game::Board::BOARD_SIZE - 1;
+                return game::bitboard::toBit(game::bitboard::toIndex({distance, distance})) |
+                       game::bitboard::toBit(game::bitboard::toIndex({uint8_t(last - distance), distance})) |
+                       game::bitboard::toBit(game::bitboard::toIndex({distance, uint8_t(last - distance)})) |
+                       game::bitboard::toBit(game::bitboard::toIndex({uint8_t(last - distance), uint8_t(last - distance)}));
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The corners, and the tiles next to them diagonally
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr game::bitboard_t CORNERS = makeDiagonalRing(0);
+            constexpr game::bitboard_t X_SQUARES = makeDiagonalRing(1);
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The scores given for each technique, so the earlier
+            ///        techniques decide the order and the later ones only
+            ///        break ties
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr int64_t TT_MOVE_SCORE = int64_t(1) << 60u;
+            constexpr int64_t KILLER_SCORE[2] = {int64_t(1) << 58u, int64_t(1) << 57u};
+            constexpr unsigned int SHALLOW_SEARCH_SHIFT = 24;
+            constexpr int64_t SQUARE_SCORE = int64_t(1) << 20u;
+            constexpr unsigned int FASTEST_FIRST_SHIFT = 12;
+            constexpr int64_t MAX_HISTORY = (int64_t(1) << FASTEST_FIRST_SHIFT) - 1;
+
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void MoveOrderer::Heuristics::newSearch()
+        {
+            for (auto& depthKillers : killers)
+            {
+                depthKillers[0] = TranspositionTable::NO_MOVE;
+                depthKillers[1] = TranspositionTable::NO_MOVE;
+            }
+
+            //Older cutoffs count for less
+            for (auto& playerHistory : history)
+            {
+                for (uint32_t& count : playerHistory) {count /= 2;}
+            }
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void MoveOrderer::Heuristics::addCutoff(const uint8_t& player, const uint8_t& square, const uint8_t& depth)
+        {
+            //Keep the last 2 different killers
+            if (killers[depth][0] != square)
+            {
+                killers[depth][1] = killers[depth][0];
+                killers[depth][0] = square;
+            }
+
+            //(deeper cutoffs save more work, and the counts can't overflow)
+            history[player][square] = std::min<uint32_t>(history[player][square] + depth * depth, UINT32_MAX / 2);
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        bool MoveOrderer::shouldSearchShallow(const uint8_t& depth, const uint8_t& ttMove) const
+        {
+            return isUsing(SHALLOW_SEARCH) && depth >= SHALLOW_SEARCH_DEPTH &&
+                   (ttMove == TranspositionTable::NO_MOVE || !isUsing(TT_MOVE));
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        std::size_t MoveOrderer::orderMoves(const game::Board& board, const uint8_t& ttMove, const uint8_t& depth,
+                const Heuristics& heuristics, const int64_t* shallowValues, uint8_t* squares) const
+        {
+            const uint8_t player = board.getCurrentPlayer();
+            const game::bitboard_t playerDisks = board.getDisks(player);
+            const game::bitboard_t opponentDisks = board.getDisks(!player);
+            const bool fastestFirst = isUsing(FASTEST_FIRST) &&
+                                      game::bitboard::popCount(board.getEmptyTiles()) <= FASTEST_FIRST_EMPTIES;
+
+            //Score every move
+            int64_t scores[game::MoveList::MAX_MOVES];
+            std::size_t count = 0;
+            game::bitboard_t moves = board.getLegalMoves();
+            while (moves)
+            {
+                const uint8_t square = game::bitboard::popLowest(moves);
+                const game::bitboard_t bit = game::bitboard::toBit(square);
+                int64_t score = 0;
+
+                if (isUsing(TT_MOVE) && square == ttMove) {score += TT_MOVE_SCORE;}
+                if (isUsing(KILLERS))
+                {
+                    if (square == heuristics.killers[depth][0]) {score += KILLER_SCORE[0];}
+                    else if (square == heuristics.killers[depth][1]) {score += KILLER_SCORE[1];}
+                }
+
+                //A shallow search knows better than the rest
+                if (shallowValues) {score += shallowValues[count] * (int64_t(1) << SHALLOW_SEARCH_SHIFT);}
+                else
+                {
+                    if (isUsing(SQUARES))
+                    {
+                        if (bit & CORNERS) {score += SQUARE_SCORE;}
+                        else if (bit & X_SQUARES) {score -= SQUARE_SCORE;}
+                    }
+                    if (fastestFirst)
+                    {
+                        //Count the opponent's moves after the move
+                        const game::bitboard_t flips = game::MoveGenerator::getFlips(playerDisks, opponentDisks, square);
+                        const game::bitboard_t opponentMoves = game::MoveGenerator::getLegalMoves(
+                                opponentDisks & ~flips, playerDisks | flips | bit);
+                        score -= int64_t(game::bitboard::popCount(opponentMoves)) << FASTEST_FIRST_SHIFT;
+                    }
+                    if (isUsing(HISTORY)) {score += std::min<int64_t>(heuristics.history[player][square], MAX_HISTORY);}
+                }
+
+                squares[count] = square;
+                scores[count] = score;
+                ++count;
+            }
+
+            //Sort the moves by score with an insertion sort, as there are only a
+            //few (and a stable sort keeps ties in tile order)
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                const uint8_t square = squares[i];
+                const int64_t score = scores[i];
+                std::size_t j = i;
+                for (; j > 0 && scores[j - 1] < score; --j)
+                {
+                    squares[j] = squares[j - 1];
+                    scores[j] = scores[j - 1];
+                }
+                squares[j] = square;
+                scores[j] = score;
+            }
+
+            return count;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        std::string MoveOrderer::toString(const uint8_t& techniques)
+        {
+            std::string str;
+            if (techniques & TT_MOVE) {str += "tt, ";}
+            if (techniques & KILLERS) {str += "killers, ";}
+            if (techniques & HISTORY) {str += "history, ";}
+            if (techniques & SQUARES) {str += "squares, ";}
+            if (techniques & FASTEST_FIRST) {str += "fastest-first, ";}
+            if (techniques & SHALLOW_SEARCH) {str += "shallow-search, ";}
+
+            //Remove the last separator
+            return str.empty() ? "none" : str.substr(0, str.size() - 2);
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        uint8_t MoveOrderer::fromString(const std::string& str)
+        {
+            uint8_t techniques = NONE;
+
+            //Read each name between the commas
+            std::istringstream stream(str);
+            std::string name;
+            while (std::getline(stream, name, ','))
+            {
+                //Ignore spaces around the names
+                const std::size_t first = name.find_first_not_of(' ');
+                name = first == std::string::npos ? "" : name.substr(first, name.find_last_not_of(' ') - first + 1);
+
+                if (name == "tt") {techniques |= TT_MOVE;}
+                else if (name == "killers") {techniques |= KILLERS;}
+                else if (name == "history") {techniques |= HISTORY;}
+                else if (name == "squares") {techniques |= SQUARES;}
+                else if (name == "fastest-first") {techniques |= FASTEST_FIRST;}
+                else if (name == "shallow-search") {techniques |= SHALLOW_SEARCH;}
+                else if (name == "all") {techniques |= ALL;}
+                else if (name != "none") {throw std::invalid_argument("Unknown move ordering '" + name + "'");}
+            }
+
+            return techniques;
+        }
+
+    }
+
+}
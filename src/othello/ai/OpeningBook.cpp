@@ -0,0 +1,265 @@
+//Standard C++:
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+//Platform headers:
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+//Othello headers:
+#include <othello/ai/AlphaBetaPruningPlayer.hpp>
+#include <othello/ai/OpeningBook.hpp>
+#include <othello/game/Symmetry.hpp>
+
+
+namespace othello
+{
+
+    namespace ai
+    {
+
+        ////////////////////////////////////////////////////////////////
+        constexpr uint8_t OpeningBook::NO_MOVE;
+        constexpr uint32_t OpeningBook::VERSION;
+        constexpr char OpeningBook::MAGIC[8];
+
+
+        ////////////////////////////////////////////////////////////////
+        OpeningBook::OpeningBook(const std::string& path)
+        {
+            //Map the whole file read-only, so every process shares its pages
+            #ifdef _WIN32
+            HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                      FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) {throw std::runtime_error("Couldn't open the opening book '" + path + "'");}
+            LARGE_INTEGER fileSize;
+            if (GetFileSizeEx(file, &fileSize)) {mappingSize = static_cast<std::size_t>(fileSize.QuadPart);}
+            if (mappingSize)
+            {
+                mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (mappingHandle) {mapping = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);}
+            }
+            CloseHandle(file);
+            #else
+            const int file = open(path.c_str(), O_RDONLY);
+            if (file < 0) {throw std::runtime_error("Couldn't open the opening book '" + path + "'");}
+            struct stat fileStatus;
+            if (fstat(file, &fileStatus) == 0) {mappingSize = static_cast<std::size_t>(fileStatus.st_size);}
+            if (mappingSize)
+            {
+                void* memory = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, file, 0);
+                if (memory != MAP_FAILED) {mapping = memory;}
+            }
+            close(file);
+            #endif
+
+            if (!mapping)
+            {
+                unmap();
+                throw std::runtime_error("Couldn't map the opening book '" + path + "'");
+            }
+
+            //Check that the file is a whole book for this board size
+            Header header;
+            std::string error;
+            if (mappingSize < sizeof(Header)) {error = "is too short";}
+            else
+            {
+                std::memcpy(&header, mapping, sizeof(Header));
+                if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {error = "isn't an opening book";}
+                else if (header.version != VERSION) {error = "has an unknown version";}
+                else if (header.boardSize != game::Board::BOARD_SIZE) {error = "is for a different board size";}
+                else if (header.numEntries != (mappingSize - sizeof(Header)) / sizeof(Entry) ||
+                         (mappingSize - sizeof(Header)) % sizeof(Entry) != 0)
+                {
+                    error = "is truncated";
+                }
+            }
+            if (!error.empty())
+            {
+                unmap();
+                throw std::runtime_error("The opening book '" + path + "' " + error);
+            }
+
+            entries = reinterpret_cast<const Entry*>(static_cast<const char*>(mapping) + sizeof(Header));
+            numEntries = static_cast<std::size_t>(header.numEntries);
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        OpeningBook::~OpeningBook()
+        {
+            unmap();
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void OpeningBook::unmap()
+        {
+            #ifdef _WIN32
+            if (mapping) {UnmapViewOfFile(mapping);}
+            if (mappingHandle) {CloseHandle(mappingHandle);}
+            #else
+            if (mapping) {munmap(const_cast<void*>(mapping), mappingSize);}
+            #endif
+            mapping = nullptr;
+            mappingHandle = nullptr;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        bool OpeningBook::probe(const game::Board& board, Entry& entry) const
+        {
+            //Search for the canonical board's hash
+            const std::pair<game::Board, uint8_t> canonical = board.getCanonical();
+            const game::hash_t hash = canonical.first.getHash();
+            const Entry* end = entries + numEntries;
+            const Entry* found = std::lower_bound(entries, end, hash, [](const Entry& e, const game::hash_t& h)
+            {
+                return e.hash < h;
+            });
+            if (found == end || found->hash != hash) {return false;}
+
+            //Turn the move back to the board's orientation
+            entry = *found;
+            if (entry.move != NO_MOVE)
+            {
+                entry.move = game::symmetry::transformIndex(entry.move, game::symmetry::inverse(canonical.second));
+            }
+            return true;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        std::size_t OpeningBook::build(const std::string& path, const uint8_t& bookDepth, const uint8_t& searchDepth,
+                const unsigned int& numThreads, const std::size_t& hashSize, const unsigned int& seed)
+        {
+            //Find the canonical positions after each number of moves. Each move
+            //adds a disk, so a position can't be found after two numbers of moves
+            std::vector<std::vector<game::Board> > levels(1, std::vector<game::Board>(1, game::Board().getCanonical().first));
+            std::unordered_map<game::hash_t, int64_t> values;
+            values.emplace(levels[0][0].getHash(), 0);
+            for (uint8_t depth = 0; depth < bookDepth; ++depth)
+            {
+                std::vector<game::Board> next;
+                for (const game::Board& board : levels[depth])
+                {
+                    game::bitboard_t possibleMoves = board.isOver() ? 0 : board.getLegalMoves();
+                    while (possibleMoves)
+                    {
+                        game::Board child = board;
+                        child.applyMove(child.createMove(game::bitboard::popLowest(possibleMoves)));
+                        const game::Board canonical = child.getCanonical().first;
+                        if (values.emplace(canonical.getHash(), 0).second) {next.push_back(canonical);}
+                    }
+                }
+                levels.push_back(std::move(next));
+            }
+
+            //The positions to search are the last ones and the ones that are over
+            std::vector<const game::Board*> leaves;
+            for (const std::vector<game::Board>& level : levels)
+            {
+                for (const game::Board& board : level)
+                {
+                    if (&level == &levels.back() || board.isOver()) {leaves.push_back(&board);}
+                }
+            }
+
+            //The index of the next position to search
+            std::atomic<std::size_t> nextLeaf{0};
+            std::vector<int64_t> leafValues(leaves.size());
+
+            //Lambda for a thread to search positions until there are none left
+            auto searchLeaves = [&]()
+            {
+                //Each thread has its own player and table, and nothing is pruned
+                //or solved so the values are all heuristic
+                AlphaBetaPruningPlayer searcher(searchDepth, std::chrono::milliseconds(0), 0, 0, seed, hashSize, false,
+                                                MoveOrderer::ALL, AlphaBetaPruningPlayer::PVS, 0, EndgameSolver::EXACT,
+                                                ProbCut(0));
+
+                for (std::size_t i = nextLeaf++; i < leaves.size(); i = nextLeaf++)
+                {
+                    //Iterative deepening fills the table for the move ordering
+                    for (uint8_t depth = 1; depth <= searchDepth; ++depth)
+                    {
+                        leafValues[i] = searcher.search(*leaves[i], depth);
+                    }
+                }
+            };
+
+            //Start the extra threads and search in this thread too
+            std::vector<std::thread> threads;
+            for (unsigned int i = 1; i < numThreads; ++i) {threads.emplace_back(searchLeaves);}
+            searchLeaves();
+            for (auto& thread : threads) {thread.join();}
+            for (std::size_t i = 0; i < leaves.size(); ++i) {values[leaves[i]->getHash()] = leafValues[i];}
+
+            //Back the values up from the last positions with minimax, which
+            //doesn't negate the values of passes
+            std::vector<Entry> entries;
+            entries.reserve(values.size());
+            for (std::size_t depth = levels.size(); depth-- > 0;)
+            {
+                for (const game::Board& board : levels[depth])
+                {
+                    Entry entry = {};
+                    entry.hash = board.getHash();
+                    entry.move = NO_MOVE;
+                    int64_t& value = values[entry.hash];
+                    if (depth < bookDepth && !board.isOver())
+                    {
+                        value = std::numeric_limits<int64_t>::min();
+                        game::bitboard_t possibleMoves = board.getLegalMoves();
+                        while (possibleMoves)
+                        {
+                            const uint8_t square = game::bitboard::popLowest(possibleMoves);
+                            game::Board child = board;
+                            child.applyMove(child.createMove(square));
+                            const int64_t childValue = values.at(child.getCanonical().first.getHash());
+                            const int64_t moveValue = child.getCurrentPlayer() == board.getCurrentPlayer() ?
+                                                      childValue : -childValue;
+                            if (moveValue > value)
+                            {
+                                value = moveValue;
+                                entry.move = square;
+                            }
+                        }
+                    }
+                    entry.value = static_cast<int32_t>(value);
+                    entries.push_back(entry);
+                }
+            }
+            std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {return a.hash < b.hash;});
+
+            //Write the header and the entries
+            std::ofstream file(path, std::ios::binary);
+            if (!file) {throw std::runtime_error("Couldn't open the opening book '" + path + "'");}
+            Header header = {};
+            std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+            header.version = VERSION;
+            header.boardSize = game::Board::BOARD_SIZE;
+            header.numEntries = entries.size();
+            file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+            file.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(Entry));
+            if (!file) {throw std::runtime_error("Couldn't write the opening book '" + path + "'");}
+
+            return entries.size();
+        }
+
+    }
+
+}
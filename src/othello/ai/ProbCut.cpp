@@ -0,0 +1,305 @@
+//Standard C++:
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+//Boost headers:
+#include <boost/random.hpp>
+//Othello headers:
+#include <othello/ai/AlphaBetaPruningPlayer.hpp>
+#include <othello/ai/ProbCut.hpp>
+#include <othello/game/Game.hpp>
+
+
+namespace othello
+{
+
+    namespace ai
+    {
+
+        namespace
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \struct DefaultParameters
+            ///
+            /// \brief Struct containing the built in parameters of a check
+            ///
+            ////////////////////////////////////////////////////////////////
+            struct DefaultParameters
+            {
+                uint8_t depth;
+                uint8_t check;
+                ProbCut::Parameters parameters;
+            };
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The built in parameters for the 8x8 board, fitted by
+            ///        ProbCut::calibrate from 100 games to depth 10
+            ///        (seed 5)
+            ///
+            /// Depth 10 is left out, as its intercepts (-8.7 and -9.5) were
+            /// far from the other depths' and every deeper search would
+            /// use them. Deeper searches use depths 8 and 9 instead
+            ///
+            ////////////////////////////////////////////////////////////////
+            const DefaultParameters DEFAULT_PARAMETERS[] = {
+                {3, 1, {1.030, 0.629, 26.730}},
+                {4, 0, {1.088, 14.907, 64.856}},
+                {4, 1, {1.020, 2.958, 16.874}},
+                {5, 0, {1.042, 2.039, 34.669}},
+                {5, 1, {1.026, 1.172, 14.760}},
+                {6, 0, {1.037, 4.055, 24.385}},
+                {6, 1, {1.023, 1.003, 13.781}},
+                {7, 0, {1.049, 2.344, 22.551}},
+                {7, 1, {1.028, 1.042, 12.956}},
+                {8, 0, {1.044, 1.793, 20.968}},
+                {8, 1, {1.024, 0.738, 12.848}},
+                {9, 0, {1.061, 2.682, 22.567}},
+                {9, 1, {1.038, 1.494, 14.449}}
+            };
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The number of random moves at the start of each
+            ///        calibration game, so the games are different
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr uint8_t OPENING_MOVES = 6;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The depth of the search playing the calibration games
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr unsigned int GAME_DEPTH = 2;
+
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        constexpr uint8_t ProbCut::NUM_CHECKS;
+        constexpr uint8_t ProbCut::REDUCTIONS[NUM_CHECKS];
+        constexpr uint8_t ProbCut::MIN_DEPTH;
+        constexpr uint8_t ProbCut::MAX_DEPTH;
+
+
+        ////////////////////////////////////////////////////////////////
+        ProbCut::ProbCut(const double& threshold) : threshold(threshold)
+        {
+            //The values of other board sizes are too different to share them
+            if (game::Board::BOARD_SIZE != 8) {return;}
+            for (const DefaultParameters& entry : DEFAULT_PARAMETERS)
+            {
+                parameters[entry.depth][entry.check] = entry.parameters;
+                maxCalibratedDepth = std::max(maxCalibratedDepth, entry.depth);
+            }
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        const ProbCut::Parameters& ProbCut::getParameters(const uint8_t& depth, const uint8_t& check) const
+        {
+            //Deeper depths use the deepest ones with the same parity, as the
+            //values of odd and even depths differ
+            if (depth <= maxCalibratedDepth) {return parameters[depth][check];}
+            return parameters[maxCalibratedDepth - ((depth - maxCalibratedDepth) & 1)][check];
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        int64_t ProbCut::getHighBound(const Parameters& check, const int64_t& beta) const
+        {
+            return static_cast<int64_t>(std::ceil((beta + threshold * check.sigma - check.intercept) / check.slope));
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        int64_t ProbCut::getLowBound(const Parameters& check, const int64_t& alpha) const
+        {
+            return static_cast<int64_t>(std::floor((alpha - threshold * check.sigma - check.intercept) / check.slope));
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void ProbCut::load(const std::string& path)
+        {
+            std::ifstream file(path);
+            if (!file) {throw std::runtime_error("Couldn't open the ProbCut parameters file '" + path + "'");}
+
+            //Replace every parameter
+            for (auto& depthParameters : parameters)
+            {
+                for (Parameters& check : depthParameters) {check = Parameters();}
+            }
+            maxCalibratedDepth = 0;
+
+            std::string line;
+            while (std::getline(file, line))
+            {
+                //Skip comments and blank lines
+                if (line.empty() || line[0] == '#') {continue;}
+
+                //Read the check, which is found by its reduction
+                std::istringstream stream(line);
+                unsigned int depth, reduction;
+                Parameters check;
+                if (!(stream >> depth >> reduction >> check.slope >> check.intercept >> check.sigma) ||
+                    depth < MIN_DEPTH || depth > MAX_DEPTH)
+                {
+                    throw std::runtime_error("Invalid ProbCut parameters '" + line + "' in '" + path + "'");
+                }
+                uint8_t c = 0;
+                while (c < NUM_CHECKS && REDUCTIONS[c] != reduction) {++c;}
+                if (c == NUM_CHECKS) {throw std::runtime_error("Invalid ProbCut reduction in '" + line + "'");}
+
+                parameters[depth][c] = check;
+                maxCalibratedDepth = std::max(maxCalibratedDepth, static_cast<uint8_t>(depth));
+            }
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void ProbCut::save(const std::string& path) const
+        {
+            std::ofstream file(path);
+            if (!file) {throw std::runtime_error("Couldn't open the ProbCut parameters file '" + path + "'");}
+
+            file << "# depth reduction slope intercept sigma" << std::endl;
+            for (uint8_t depth = MIN_DEPTH; depth <= maxCalibratedDepth; ++depth)
+            {
+                for (uint8_t c = 0; c < NUM_CHECKS; ++c)
+                {
+                    const Parameters& check = parameters[depth][c];
+                    if (check.slope <= 0) {continue;}
+                    file << int(depth) << ' ' << int(REDUCTIONS[c]) << ' ' << check.slope << ' ' << check.intercept
+                         << ' ' << check.sigma << std::endl;
+                }
+            }
+            if (!file) {throw std::runtime_error("Couldn't write the ProbCut parameters file '" + path + "'");}
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        ProbCut ProbCut::calibrate(const unsigned int& numGames, const uint8_t& maxDepth, const unsigned int& seed,
+                const std::size_t& hashSize, const double& threshold)
+        {
+            //Neither search prunes anything, and neither solves the game
+            const ProbCut noProbCut(0);
+            auto gamePlayer = std::make_shared<AlphaBetaPruningPlayer>(
+                    GAME_DEPTH, std::chrono::milliseconds(0), 0, 0, seed, std::size_t(1) << 20u, false,
+                    MoveOrderer::ALL, AlphaBetaPruningPlayer::PVS, 0, EndgameSolver::EXACT, noProbCut);
+            AlphaBetaPruningPlayer searcher(maxDepth, std::chrono::milliseconds(0), 0, 0, seed, hashSize, false,
+                                            MoveOrderer::ALL, AlphaBetaPruningPlayer::PVS, 0, EndgameSolver::EXACT,
+                                            noProbCut);
+
+            //Keep the positions of self-play games that are far enough from the
+            //end for the deepest search not to reach it
+            std::vector<game::Board> positions;
+            game::Game game;
+            game.setPlayers(gamePlayer, gamePlayer);
+            game.addPostTurnCallback([&positions, &maxDepth](const game::Game& g, const uint8_t&)
+            {
+                const game::Board& board = g.getBoard();
+                if (!board.isOver() && game::bitboard::popCount(board.getEmptyTiles()) > maxDepth)
+                {
+                    positions.push_back(board);
+                }
+            });
+
+            boost::random::mt19937 randomNumberGenerator(seed);
+            for (unsigned int i = 0; i < numGames; ++i)
+            {
+                //Start from a few random moves
+                game.reset();
+                game::Board board;
+                game::MoveList moves;
+                for (uint8_t m = 0; m < OPENING_MOVES && !board.isOver(); ++m)
+                {
+                    board.getPossibleMoves(moves);
+                    boost::random::uniform_int_distribution<> distribution(0, moves.size() - 1);
+                    board.applyMove(moves[distribution(randomNumberGenerator)]);
+                }
+                game.setBoard(board);
+                game.playGame();
+            }
+
+            //Search every position to every depth, keeping the pairs of shallow
+            //and deep values of each check
+            std::vector<std::pair<double, double> > samples[MAX_DEPTH + 1][NUM_CHECKS];
+            std::vector<int64_t> values(maxDepth + 1);
+            for (const game::Board& board : positions)
+            {
+                bool solved = false;
+                for (uint8_t depth = 0; depth <= maxDepth; ++depth)
+                {
+                    values[depth] = searcher.search(board, depth);
+                    solved |= std::abs(values[depth]) >= AlphaBetaPruningPlayer::SOLVED_VALUE / 2;
+                }
+                if (solved) {continue;}
+
+                for (uint8_t depth = MIN_DEPTH; depth <= maxDepth; ++depth)
+                {
+                    for (uint8_t c = 0; c < NUM_CHECKS; ++c)
+                    {
+                        if (depth < REDUCTIONS[c]) {continue;}
+                        samples[depth][c].emplace_back(values[depth - REDUCTIONS[c]], values[depth]);
+                    }
+                }
+            }
+
+            //Fit each check with least squares
+            ProbCut probCut(threshold);
+            for (auto& depthParameters : probCut.parameters)
+            {
+                for (Parameters& check : depthParameters) {check = Parameters();}
+            }
+            probCut.maxCalibratedDepth = 0;
+            for (uint8_t depth = MIN_DEPTH; depth <= maxDepth; ++depth)
+            {
+                for (uint8_t c = 0; c < NUM_CHECKS; ++c)
+                {
+                    const std::vector<std::pair<double, double> >& pairs = samples[depth][c];
+                    if (pairs.size() < 2) {continue;}
+
+                    double meanShallow = 0, meanDeep = 0;
+                    for (const auto& pair : pairs)
+                    {
+                        meanShallow += pair.first;
+                        meanDeep += pair.second;
+                    }
+                    meanShallow /= pairs.size();
+                    meanDeep /= pairs.size();
+
+                    double covariance = 0, variance = 0;
+                    for (const auto& pair : pairs)
+                    {
+                        covariance += (pair.first - meanShallow) * (pair.second - meanDeep);
+                        variance += (pair.first - meanShallow) * (pair.first - meanShallow);
+                    }
+                    if (variance <= 0 || covariance <= 0) {continue;}
+
+                    Parameters& check = probCut.parameters[depth][c];
+                    check.slope = covariance / variance;
+                    check.intercept = meanDeep - check.slope * meanShallow;
+                    double error = 0;
+                    for (const auto& pair : pairs)
+                    {
+                        const double residual = pair.second - check.slope * pair.first - check.intercept;
+                        error += residual * residual;
+                    }
+                    check.sigma = std::sqrt(error / pairs.size());
+                    probCut.maxCalibratedDepth = depth;
+                }
+            }
+            return probCut;
+        }
+
+    }
+
+}
@@ -45,29 +45,18 @@ namespace othello
         
         ////////////////////////////////////////////////////////////////
         const game::Move* QLearningPlayer::makeMove(const game::Game& game, const uint8_t& player,
-                                                        const std::vector<game::Move>& possibleMoves)
+                                                        const game::MoveList& possibleMoves)
         {
             //Create an input array of 0s
             std::array<fann_type, game::Board::BOARD_SIZE * game::Board::BOARD_SIZE> input = {0};
             
-            //Iterate over the tiles of the board
-            std::size_t i = 0;
-            for (uint8_t y = 0; y < game::Board::BOARD_SIZE; ++y)
-            {
-                for (uint8_t x = 0; x < game::Board::BOARD_SIZE; ++x)
-                {
-                    //If it's claimed
-                    if (game.getBoard().getTile({x, y}).isClaimed)
-                    {
-                        //Claimed by "me" is 1
-                        if (game.getBoard().getTile({x, y}).claimant == player) {input[i] = 1;}
-                            //Claimed by the other player is -1
-                        else {input[i] = -1;}
-                    }
-                    else {input[i] = 0;}
-                    ++i;
-                }
-            }
+            //Claimed by "me" is 1
+            game::bitboard_t disks = game.getBoard().getDisks(player);
+            while (disks) {input[game::bitboard::toTileNumber(game::bitboard::popLowest(disks))] = 1;}
+            
+            //Claimed by the other player is -1
+            disks = game.getBoard().getDisks(!player);
+            while (disks) {input[game::bitboard::toTileNumber(game::bitboard::popLowest(disks))] = -1;}
             
             //Run the input into the nn
             auto outputPtr = mlp.run(input.data());
@@ -82,11 +71,10 @@ namespace othello
             fann_type selectedMove_intensity = std::numeric_limits<fann_type>::lowest();
             
             //Iterate over the possible moves to get the one with the strongest signal in the NN
-            for (i = 0; i < possibleMoves.size(); ++i)
+            for (std::size_t i = 0; i < possibleMoves.size(); ++i)
             {
                 //Get the index of the move in the neural network's output
-                uint8_t index = (possibleMoves[i].diskPosition.y * game::Board::BOARD_SIZE) +
-                                possibleMoves[i].diskPosition.x;
+                uint8_t index = game::bitboard::toTileNumber(possibleMoves[i].square);
                 //If the neural network likes it more
                 if (output[index] > selectedMove_intensity)
                 {
@@ -107,8 +95,7 @@ namespace othello
                 selectedMove_possibleMovesI = moveDistribution(randomNumberGenerator);
                 
                 //Get its index in the nn
-                selectedMove_nnI = (possibleMoves[selectedMove_possibleMovesI].diskPosition.y * game::Board::BOARD_SIZE) +
-                                   possibleMoves[selectedMove_possibleMovesI].diskPosition.x;
+                selectedMove_nnI = game::bitboard::toTileNumber(possibleMoves[selectedMove_possibleMovesI].square);
             }
             
             //If we're in training mode
@@ -0,0 +1,113 @@
+//Standard C++:
+#include <cmath>
+#include <iomanip>
+//Othello headers:
+#include <othello/ai/SearchStatistics.hpp>
+#include <othello/game/Bitboard.hpp>
+
+
+namespace othello
+{
+
+    namespace ai
+    {
+
+        ////////////////////////////////////////////////////////////////
+        SearchStatistics::Counters& SearchStatistics::Counters::operator+=(const Counters& other)
+        {
+            leaves += other.leaves;
+            cutoffs += other.cutoffs;
+            firstMoveCutoffs += other.firstMoveCutoffs;
+            probCuts += other.probCuts;
+            tableProbes += other.tableProbes;
+            tableHits += other.tableHits;
+            tableStores += other.tableStores;
+            return *this;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        double SearchStatistics::getNodesPerSecond() const
+        {
+            return seconds > 0 ? nodes / seconds : 0;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        double SearchStatistics::getFirstMoveCutoffRate() const
+        {
+            return counters.cutoffs ? double(counters.firstMoveCutoffs) / counters.cutoffs : 0;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        double SearchStatistics::getTableHitRate() const
+        {
+            return counters.tableProbes ? double(counters.tableHits) / counters.tableProbes : 0;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        double SearchStatistics::getEffectiveBranchingFactor() const
+        {
+            //The geometric mean of the growth from the first finished iteration
+            //to the last one
+            const Iteration* first = nullptr;
+            const Iteration* last = nullptr;
+            for (const Iteration& iteration : iterations)
+            {
+                if (!iteration.finished || !iteration.nodes) {continue;}
+                if (!first) {first = &iteration;}
+                last = &iteration;
+            }
+            if (!first || last->depth == first->depth) {return 0;}
+            return std::pow(double(last->nodes) / first->nodes, 1.0 / (last->depth - first->depth));
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void SearchStatistics::print(std::ostream& out) const
+        {
+            const std::ios::fmtflags flags = out.flags();
+            const std::streamsize precision = out.precision();
+            out << std::fixed;
+
+            out << "Search: " << (book ? "book" : solved ? "solved" : "depth " + std::to_string(depth)) << ", " << nodes << " nodes ("
+                << counters.leaves << " leaves), " << std::setprecision(3) << seconds << "s, " << std::setprecision(0)
+                << getNodesPerSecond() << " nodes/s" << std::endl;
+            out << "  Cutoffs: " << counters.cutoffs << " (" << std::setprecision(1) << 100 * getFirstMoveCutoffRate()
+                << "% by the first move), EBF " << std::setprecision(2) << getEffectiveBranchingFactor()
+                << ", ProbCuts " << counters.probCuts << std::endl;
+            if (ponderNodes) {out << "  Pondered: " << ponderNodes << " nodes" << std::endl;}
+            out << "  Table: " << counters.tableProbes << " probes, " << std::setprecision(1) << 100 * getTableHitRate()
+                << "% hits, " << counters.tableStores << " stores" << std::endl;
+
+            if (!iterations.empty())
+            {
+                out << "  Iterations:";
+                for (const Iteration& iteration : iterations)
+                {
+                    out << " " << int(iteration.depth) << (iteration.finished ? "" : "*") << " ("
+                        << std::setprecision(3) << iteration.seconds << "s, " << iteration.nodes << " nodes)";
+                }
+                out << std::endl;
+            }
+            if (!rootMoves.empty())
+            {
+                out << "  Root moves:";
+                for (const RootMove& move : rootMoves)
+                {
+                    const game::TilePosition pos = game::bitboard::toPosition(move.square);
+                    out << " " << static_cast<char>('a' + pos.x) << pos.y + 1 << " " << std::setprecision(3)
+                        << move.seconds << "s";
+                }
+                out << std::endl;
+            }
+
+            out.flags(flags);
+            out.precision(precision);
+        }
+
+    }
+
+}
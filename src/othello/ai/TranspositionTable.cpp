@@ -0,0 +1,200 @@
+//Standard C++:
+#include <cstdlib>
+#include <new>
+//Platform headers:
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#endif
+//Othello headers:
+#include <othello/ai/TranspositionTable.hpp>
+
+
+namespace othello
+{
+
+    namespace ai
+    {
+
+        namespace
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The size (and alignment) of a huge page on x86
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr std::size_t HUGE_PAGE_SIZE = std::size_t(1) << 21u;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The bit positions of the fields in an entry's data
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr unsigned int DEPTH_SHIFT = 32;
+            constexpr unsigned int BOUND_SHIFT = 40;
+            constexpr unsigned int GENERATION_SHIFT = 42;
+            constexpr unsigned int MOVE_SHIFT = 48;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to pack an entry into 64 bits
+            ///
+            /// \note The data of a stored entry is never zero as its bound
+            ///       isn't NONE, so zero marks an empty slot
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline uint64_t pack(const int32_t& value, const uint8_t& depth, const uint8_t& bound,
+                    const uint8_t& generation, const uint8_t& move)
+            {
+                return uint64_t(uint32_t(value)) | (uint64_t(depth) << DEPTH_SHIFT) |
+                       (uint64_t(bound & 0x3u) << BOUND_SHIFT) | (uint64_t(generation & 0x3Fu) << GENERATION_SHIFT) |
+                       (uint64_t(move) << MOVE_SHIFT);
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Functions to get the fields of an entry's data
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline uint8_t getDepth(const uint64_t& data) {return uint8_t(data >> DEPTH_SHIFT);}
+            inline uint8_t getBound(const uint64_t& data) {return uint8_t((data >> BOUND_SHIFT) & 0x3u);}
+            inline uint8_t getGeneration(const uint64_t& data) {return uint8_t((data >> GENERATION_SHIFT) & 0x3Fu);}
+            inline uint8_t getMove(const uint64_t& data) {return uint8_t(data >> MOVE_SHIFT);}
+
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        TranspositionTable::TranspositionTable(const std::size_t& size, const bool& useHugePages)
+        {
+            //Use the most buckets that fit, as a power of 2 so the index is a mask
+            std::size_t count = size / sizeof(Bucket);
+            if (count == 0) {return;}
+            numBuckets = 1;
+            while (numBuckets * 2 <= count) {numBuckets *= 2;}
+
+            const std::size_t bytes = numBuckets * sizeof(Bucket);
+            void* memory = nullptr;
+
+            #ifdef _WIN32
+            //(large pages need a privilege on Windows, so they're never used)
+            memory = _aligned_malloc(bytes, alignof(Bucket));
+            #else
+            //Huge pages are only used for memory aligned to them
+            hugePages = useHugePages && bytes >= HUGE_PAGE_SIZE;
+            if (posix_memalign(&memory, hugePages ? HUGE_PAGE_SIZE : alignof(Bucket), bytes) != 0) {memory = nullptr;}
+            #ifdef MADV_HUGEPAGE
+            //(only a hint, so it doesn't matter if it fails)
+            if (memory && hugePages) {madvise(memory, bytes, MADV_HUGEPAGE);}
+            #else
+            hugePages = false;
+            #endif
+            #endif
+
+            if (!memory) {throw std::bad_alloc();}
+
+            //Construct the buckets
+            buckets = static_cast<Bucket*>(memory);
+            for (std::size_t i = 0; i < numBuckets; ++i) {new (&buckets[i]) Bucket();}
+            clear();
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        TranspositionTable::~TranspositionTable()
+        {
+            if (!buckets) {return;}
+
+            //(the buckets are trivially destructible)
+            #ifdef _WIN32
+            _aligned_free(buckets);
+            #else
+            free(buckets);
+            #endif
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void TranspositionTable::clear()
+        {
+            for (std::size_t i = 0; i < numBuckets; ++i)
+            {
+                for (Slot& slot : buckets[i].slots)
+                {
+                    slot.key.store(0, std::memory_order_relaxed);
+                    slot.data.store(0, std::memory_order_relaxed);
+                }
+            }
+            generation = 0;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        bool TranspositionTable::probe(const game::hash_t& hash, Entry& entry) const
+        {
+            if (!buckets) {return false;}
+
+            for (const Slot& slot : getBucket(hash).slots)
+            {
+                //If another thread wrote half of the slot, the key won't match
+                const uint64_t data = slot.data.load(std::memory_order_relaxed);
+                if (data == 0 || (slot.key.load(std::memory_order_relaxed) ^ data) != hash) {continue;}
+
+                entry.value = int32_t(uint32_t(data));
+                entry.depth = getDepth(data);
+                entry.bound = Bound(getBound(data));
+                entry.move = getMove(data);
+                return true;
+            }
+            return false;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void TranspositionTable::store(const game::hash_t& hash, const int32_t& value, const uint8_t& depth,
+                const Bound& bound, const uint8_t& move)
+        {
+            if (!buckets) {return;}
+
+            Bucket& bucket = getBucket(hash);
+            Slot* replace = nullptr;
+            int replaceScore = INT32_MAX;
+
+            for (Slot& slot : bucket.slots)
+            {
+                const uint64_t data = slot.data.load(std::memory_order_relaxed);
+
+                //If the position is already stored
+                if (data != 0 && (slot.key.load(std::memory_order_relaxed) ^ data) == hash)
+                {
+                    //Keep a deeper result from this search, unless this one is exact
+                    if (bound != EXACT && depth < getDepth(data) && getGeneration(data) == generation) {return;}
+
+                    //Keep the best move if this search didn't find one
+                    const uint8_t newMove = move == NO_MOVE ? getMove(data) : move;
+                    const uint64_t newData = pack(value, depth, bound, generation, newMove);
+                    slot.key.store(hash ^ newData, std::memory_order_relaxed);
+                    slot.data.store(newData, std::memory_order_relaxed);
+                    return;
+                }
+
+                //Otherwise replace an empty slot, or else the oldest and shallowest
+                //(an entry counts as 8 plies shallower for each search since it was stored)
+                const int age = (generation - getGeneration(data)) & 0x3F;
+                const int score = data == 0 ? INT32_MIN : getDepth(data) - 8 * age;
+                if (score < replaceScore)
+                {
+                    replace = &slot;
+                    replaceScore = score;
+                }
+            }
+
+            const uint64_t newData = pack(value, depth, bound, generation, move);
+            replace->key.store(hash ^ newData, std::memory_order_relaxed);
+            replace->data.store(newData, std::memory_order_relaxed);
+        }
+
+    }
+
+}
@@ -11,11 +11,13 @@ namespace othello
     
         ////////////////////////////////////////////////////////////////
         void BoardPrinter::print(const game::Board& board, const uint8_t& player,
-                const std::vector<game::Move>& possibleMoves)
+                const game::MoveList& possibleMoves)
         {
             //Print the board's state
             std::cout << "Player " << (int)player << " (" << (!(bool)(player - 1) ? 'X' : 'O') << "):" << std::endl;
-            std::cout << "    a | b | c | d | e | f | g | h " << std::endl;
+            std::cout << "    a";
+            for (uint8_t x = 1; x < othello::game::Board::BOARD_SIZE; ++x) {std::cout << " | " << (char)('a' + x);}
+            std::cout << " " << std::endl;
             for (uint8_t y = 0; y < othello::game::Board::BOARD_SIZE; ++y)
             {
                 std::cout << y + 1 << " | ";
@@ -29,7 +31,7 @@ namespace othello
                         for (const othello::game::Move& move : possibleMoves)
                         {
                             //If the move is a match
-                            if (move.diskPosition.x == x && move.diskPosition.y == y)
+                            if (move.getDiskPosition().x == x && move.getDiskPosition().y == y)
                             {
                                 //Display the cell as a question mark
                                 std::cout << "? | ";
@@ -0,0 +1,368 @@
+//Standard C++:
+#include <stdexcept>
+#include <utility>
+//Othello headers:
+#include <othello/game/BoardBatch.hpp>
+#include <othello/game/MoveGenerator.hpp>
+#include <othello/util/CpuFeatures.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        namespace
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Mask of every tile that isn't in the left-most or
+            ///        right-most column
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr bitboard_t NOT_EDGE_COLUMNS = 0x7E7E7E7E7E7E7E7EULL;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The kernels on one board at a time
+            ///
+            ////////////////////////////////////////////////////////////////
+            namespace scalar
+            {
+
+                ////////////////////////////////////////////////////////////////
+                /// \struct Ops
+                ///
+                /// \brief The operations the kernels need, on one board at a
+                ///        time
+                ///
+                /// Each instruction set has a struct like this one, so the same
+                /// kernels are compiled for 1, 4 (AVX2) or 8 (AVX-512) boards
+                /// per operation
+                ///
+                ////////////////////////////////////////////////////////////////
+                struct Ops
+                {
+                    typedef bitboard_t V;
+                    static constexpr std::size_t WIDTH = 1;
+
+                    static V load(const bitboard_t* p) {return *p;}
+                    static void store(bitboard_t* p, const V& v) {*p = v;}
+                    static V set1(const bitboard_t& b) {return b;}
+                    static V andOp(const V& a, const V& b) {return a & b;}
+                    static V orOp(const V& a, const V& b) {return a | b;}
+                    static V xorOp(const V& a, const V& b) {return a ^ b;}
+                    static V andNot(const V& a, const V& b) {return ~a & b;}
+                    static V isZero(const V& v) {return v ? 0 : ~bitboard_t(0);}
+                    template<int S> static V shift(const V& v) {return S > 0 ? v << (S > 0 ? S : 0) : v >> (S > 0 ? 0 : -S);}
+                    static V popCount(const V& v) {return bitboard::popCount(v);}
+                    static V sub(const V& a, const V& b) {return a - b;}
+                    static V add(const V& a, const V& b) {return a + b;}
+                    static V mul(const V& a, const int64_t& w) {return static_cast<V>(static_cast<int64_t>(a) * w);}
+                };
+
+
+                #include "BoardBatchKernels.inl"
+
+            }
+
+
+            #ifdef OTHELLO_X86_KERNELS
+            #pragma GCC push_options
+            #pragma GCC target("avx2")
+            ////////////////////////////////////////////////////////////////
+            /// \brief The kernels on 4 boards at a time, using AVX2
+            ///
+            ////////////////////////////////////////////////////////////////
+            namespace avx2
+            {
+
+                ////////////////////////////////////////////////////////////////
+                /// \struct Ops
+                ///
+                /// \brief The operations the kernels need, on 4 boards at a
+                ///        time
+                ///
+                ////////////////////////////////////////////////////////////////
+                struct Ops
+                {
+                    typedef __m256i V;
+                    static constexpr std::size_t WIDTH = 4;
+
+                    static V load(const bitboard_t* p) {return _mm256_loadu_si256(reinterpret_cast<const V*>(p));}
+                    static void store(bitboard_t* p, const V& v) {_mm256_storeu_si256(reinterpret_cast<V*>(p), v);}
+                    static V set1(const bitboard_t& b) {return _mm256_set1_epi64x(static_cast<long long>(b));}
+                    static V andOp(const V& a, const V& b) {return _mm256_and_si256(a, b);}
+                    static V orOp(const V& a, const V& b) {return _mm256_or_si256(a, b);}
+                    static V xorOp(const V& a, const V& b) {return _mm256_xor_si256(a, b);}
+                    static V andNot(const V& a, const V& b) {return _mm256_andnot_si256(a, b);}
+                    static V isZero(const V& v) {return _mm256_cmpeq_epi64(v, _mm256_setzero_si256());}
+                    template<int S> static V shift(const V& v)
+                    {
+                        return S > 0 ? _mm256_slli_epi64(v, S > 0 ? S : 0) : _mm256_srli_epi64(v, S > 0 ? 0 : -S);
+                    }
+                    static V popCount(const V& v)
+                    {
+                        //Count the bits of each nibble with a lookup table, then add
+                        //the bytes of each 64 bit lane together
+                        const V table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                         0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+                        const V nibbles = _mm256_set1_epi8(0x0F);
+                        const V counts = _mm256_add_epi8(_mm256_shuffle_epi8(table, _mm256_and_si256(v, nibbles)),
+                                _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi64(v, 4), nibbles)));
+                        return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+                    }
+                    static V sub(const V& a, const V& b) {return _mm256_sub_epi64(a, b);}
+                    static V add(const V& a, const V& b) {return _mm256_add_epi64(a, b);}
+                    static V mul(const V& a, const int64_t& w)
+                    {
+                        //The counts and weights are small, so a 32 bit multiply is enough
+                        return _mm256_mul_epi32(a, _mm256_set1_epi64x(w));
+                    }
+                };
+
+
+                #include "BoardBatchKernels.inl"
+
+            }
+            #pragma GCC pop_options
+
+
+            #pragma GCC push_options
+            #pragma GCC target("avx2,avx512f,avx512bw")
+            ////////////////////////////////////////////////////////////////
+            /// \brief The kernels on 8 boards at a time, using AVX-512
+            ///
+            ////////////////////////////////////////////////////////////////
+            namespace avx512
+            {
+
+                ////////////////////////////////////////////////////////////////
+                /// \struct Ops
+                ///
+                /// \brief The operations the kernels need, on 8 boards at a
+                ///        time
+                ///
+                ////////////////////////////////////////////////////////////////
+                struct Ops
+                {
+                    typedef __m512i V;
+                    static constexpr std::size_t WIDTH = 8;
+
+                    static V load(const bitboard_t* p) {return _mm512_loadu_si512(p);}
+                    static void store(bitboard_t* p, const V& v) {_mm512_storeu_si512(p, v);}
+                    static V set1(const bitboard_t& b) {return _mm512_set1_epi64(static_cast<long long>(b));}
+                    static V andOp(const V& a, const V& b) {return _mm512_and_si512(a, b);}
+                    static V orOp(const V& a, const V& b) {return _mm512_or_si512(a, b);}
+                    static V xorOp(const V& a, const V& b) {return _mm512_xor_si512(a, b);}
+                    static V andNot(const V& a, const V& b) {return _mm512_andnot_si512(a, b);}
+                    static V isZero(const V& v) {return _mm512_maskz_set1_epi64(_mm512_testn_epi64_mask(v, v), -1);}
+                    template<int S> static V shift(const V& v)
+                    {
+                        return S > 0 ? _mm512_slli_epi64(v, S > 0 ? S : 0) : _mm512_srli_epi64(v, S > 0 ? 0 : -S);
+                    }
+                    static V popCount(const V& v)
+                    {
+                        //Same as AVX2, with twice as many lanes
+                        const V table = _mm512_set4_epi32(0x04030302, 0x03020201, 0x03020201, 0x02010100);
+                        const V nibbles = _mm512_set1_epi8(0x0F);
+                        const V counts = _mm512_add_epi8(_mm512_shuffle_epi8(table, _mm512_and_si512(v, nibbles)),
+                                _mm512_shuffle_epi8(table, _mm512_and_si512(_mm512_srli_epi64(v, 4), nibbles)));
+                        return _mm512_sad_epu8(counts, _mm512_setzero_si512());
+                    }
+                    static V sub(const V& a, const V& b) {return _mm512_sub_epi64(a, b);}
+                    static V add(const V& a, const V& b) {return _mm512_add_epi64(a, b);}
+                    static V mul(const V& a, const int64_t& w) {return _mm512_mul_epi32(a, _mm512_set1_epi64(w));}
+                };
+
+
+                #include "BoardBatchKernels.inl"
+
+            }
+            #pragma GCC pop_options
+            #endif
+
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        std::size_t BoardBatch::getVectorWidth()
+        {
+            #ifdef OTHELLO_X86_KERNELS
+            if (util::CpuFeatures::isEnabled(util::CpuFeatures::AVX512)) {return avx512::Ops::WIDTH;}
+            if (util::CpuFeatures::isEnabled(util::CpuFeatures::AVX2)) {return avx2::Ops::WIDTH;}
+            #endif
+            return scalar::Ops::WIDTH;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void BoardBatch::calculateLegalMoves(const std::size_t& first)
+        {
+            legalMoves.resize(playerDisks.size());
+
+            //Calculate the legal moves of as many boards at once as the widest
+            //enabled instruction set allows, then the rest with narrower ones
+            std::size_t i = first;
+            #ifdef OTHELLO_X86_KERNELS
+            if (util::CpuFeatures::isEnabled(util::CpuFeatures::AVX512))
+            {
+                i = avx512::legalMovesRange(playerDisks.data(), opponentDisks.data(), legalMoves.data(), i, size());
+            }
+            if (util::CpuFeatures::isEnabled(util::CpuFeatures::AVX2))
+            {
+                i = avx2::legalMovesRange(playerDisks.data(), opponentDisks.data(), legalMoves.data(), i, size());
+            }
+            #endif
+            scalar::legalMovesRange(playerDisks.data(), opponentDisks.data(), legalMoves.data(), i, size());
+
+            //If a player can't move, the other player moves instead
+            //(if they also can't, the game is over and the moves stay empty)
+            for (std::size_t i = first; i < size(); ++i)
+            {
+                if (!legalMoves[i])
+                {
+                    std::swap(playerDisks[i], opponentDisks[i]);
+                    currentPlayers[i] = !currentPlayers[i];
+                    legalMoves[i] = MoveGenerator::getLegalMoves(playerDisks[i], opponentDisks[i]);
+                }
+            }
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void BoardBatch::add(const Board& board)
+        {
+            playerDisks.push_back(board.getPlayerDisks());
+            opponentDisks.push_back(board.getOpponentDisks());
+            legalMoves.push_back(board.getLegalMoves());
+            currentPlayers.push_back(board.getCurrentPlayer());
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        std::size_t BoardBatch::addChildren(const Board& board)
+        {
+            const std::size_t first = size();
+
+            //Make every move (the player to move swaps)
+            bitboard_t possibleMoves = board.getLegalMoves();
+            while (possibleMoves)
+            {
+                const uint8_t square = bitboard::popLowest(possibleMoves);
+                const bitboard_t flips = MoveGenerator::getFlips(board.getPlayerDisks(), board.getOpponentDisks(),
+                        square);
+                playerDisks.push_back(board.getOpponentDisks() ^ flips);
+                opponentDisks.push_back(board.getPlayerDisks() ^ flips ^ bitboard::toBit(square));
+                currentPlayers.push_back(!board.getCurrentPlayer());
+            }
+
+            //Find the children's moves together
+            calculateLegalMoves(first);
+            return size() - first;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void BoardBatch::clear()
+        {
+            playerDisks.clear();
+            opponentDisks.clear();
+            legalMoves.clear();
+            currentPlayers.clear();
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        std::size_t BoardBatch::size() const {return playerDisks.size();}
+
+
+        ////////////////////////////////////////////////////////////////
+        bool BoardBatch::empty() const {return playerDisks.empty();}
+
+
+        ////////////////////////////////////////////////////////////////
+        Board BoardBatch::getBoard(const std::size_t& i) const
+        {
+            return currentPlayers[i] ? Board({opponentDisks[i], playerDisks[i]}, 1) :
+                   Board({playerDisks[i], opponentDisks[i]}, 0);
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        const bitboard_t* BoardBatch::getLegalMoves() const {return legalMoves.data();}
+
+
+        ////////////////////////////////////////////////////////////////
+        const uint8_t* BoardBatch::getCurrentPlayers() const {return currentPlayers.data();}
+
+
+        ////////////////////////////////////////////////////////////////
+        void BoardBatch::makeMoves(const uint8_t* squares)
+        {
+            //Make sure every move is legal before any board changes
+            for (std::size_t i = 0; i < size(); ++i)
+            {
+                if (squares[i] >= bitboard::ROW_SIZE * bitboard::ROW_SIZE ||
+                    !(legalMoves[i] & bitboard::toBit(squares[i])))
+                {
+                    throw std::invalid_argument("Square given to 'BoardBatch::makeMoves' isn't a legal move");
+                }
+            }
+
+            //The legal moves hold the moves until they're recalculated
+            for (std::size_t i = 0; i < size(); ++i) {legalMoves[i] = bitboard::toBit(squares[i]);}
+
+            //Place the disks and flip the other disks (as many boards at once as
+            //possible, like calculateLegalMoves). The player to move swaps
+            std::size_t i = 0;
+            #ifdef OTHELLO_X86_KERNELS
+            if (util::CpuFeatures::isEnabled(util::CpuFeatures::AVX512))
+            {
+                i = avx512::makeMovesRange(playerDisks.data(), opponentDisks.data(), legalMoves.data(), i, size());
+            }
+            if (util::CpuFeatures::isEnabled(util::CpuFeatures::AVX2))
+            {
+                i = avx2::makeMovesRange(playerDisks.data(), opponentDisks.data(), legalMoves.data(), i, size());
+            }
+            #endif
+            scalar::makeMovesRange(playerDisks.data(), opponentDisks.data(), legalMoves.data(), i, size());
+            for (i = 0; i < size(); ++i) {currentPlayers[i] = !currentPlayers[i];}
+
+            calculateLegalMoves(0);
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void BoardBatch::getWeightedDiskCounts(const uint8_t& player, const bitboard_t* masks, const int64_t* weights,
+                const std::size_t& numGroups, int64_t* scores) const
+        {
+            //Score the boards for the player to move (as many at once as
+            //possible, like calculateLegalMoves)
+            std::size_t i = 0;
+            #ifdef OTHELLO_X86_KERNELS
+            if (util::CpuFeatures::isEnabled(util::CpuFeatures::AVX512))
+            {
+                i = avx512::weightedCountsRange(playerDisks.data(), opponentDisks.data(), masks, weights, numGroups,
+                        scores, i, size());
+            }
+            if (util::CpuFeatures::isEnabled(util::CpuFeatures::AVX2))
+            {
+                i = avx2::weightedCountsRange(playerDisks.data(), opponentDisks.data(), masks, weights, numGroups,
+                        scores, i, size());
+            }
+            #endif
+            scalar::weightedCountsRange(playerDisks.data(), opponentDisks.data(), masks, weights, numGroups, scores,
+                    i, size());
+
+            //Flip the scores of the boards where it's the other player's turn
+            for (i = 0; i < size(); ++i)
+            {
+                if (currentPlayers[i] != player) {scores[i] = -scores[i];}
+            }
+        }
+
+    }
+
+}
@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////
+/// The kernels of BoardBatch
+///
+/// This file is included by BoardBatch.cpp once per instruction
+/// set, inside a namespace with a struct `Ops` of the operations
+/// the kernels need (see scalar::Ops in BoardBatch.cpp) and
+/// between pragmas that
+/// target the instruction set, so every copy of the kernels is
+/// compiled for its own instruction set
+///
+////////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////////
+/// \brief Function to get the tiles one step past the runs of
+///        opponent disks that start next to the player's disks,
+///        using a Kogge-Stone fill in the direction S
+///
+////////////////////////////////////////////////////////////////
+template<int S>
+inline Ops::V movesInDirection(const Ops::V& player, Ops::V pro)
+{
+    Ops::V gen = Ops::orOp(player, Ops::andOp(pro, Ops::shift<S>(player)));
+    pro = Ops::andOp(pro, Ops::shift<S>(pro));
+    gen = Ops::orOp(gen, Ops::andOp(pro, Ops::shift<2 * S>(gen)));
+    pro = Ops::andOp(pro, Ops::shift<2 * S>(pro));
+    gen = Ops::orOp(gen, Ops::andOp(pro, Ops::shift<4 * S>(gen)));
+    return Ops::shift<S>(Ops::xorOp(gen, player));
+}
+
+
+////////////////////////////////////////////////////////////////
+/// \brief Function to get the opponent disks a move flips in the
+///        direction S, using a Kogge-Stone fill from the move
+///
+////////////////////////////////////////////////////////////////
+template<int S>
+inline Ops::V flipsInDirection(const Ops::V& move, const Ops::V& player, Ops::V pro)
+{
+    Ops::V gen = Ops::orOp(move, Ops::andOp(pro, Ops::shift<S>(move)));
+    pro = Ops::andOp(pro, Ops::shift<S>(pro));
+    gen = Ops::orOp(gen, Ops::andOp(pro, Ops::shift<2 * S>(gen)));
+    pro = Ops::andOp(pro, Ops::shift<2 * S>(pro));
+    gen = Ops::orOp(gen, Ops::andOp(pro, Ops::shift<4 * S>(gen)));
+
+    //The run of opponent disks is only flipped if one of the player's disks
+    //is past it
+    return Ops::andNot(Ops::isZero(Ops::andOp(Ops::shift<S>(gen), player)), Ops::xorOp(gen, move));
+}
+
+
+////////////////////////////////////////////////////////////////
+/// \brief Kernel to calculate the legal moves of Ops::WIDTH
+///        boards
+///
+////////////////////////////////////////////////////////////////
+inline void legalMovesKernel(const bitboard_t* players, const bitboard_t* opponents, bitboard_t* out)
+{
+    const Ops::V p = Ops::load(players);
+    const Ops::V o = Ops::load(opponents);
+    const Ops::V masked = Ops::andOp(o, Ops::set1(NOT_EDGE_COLUMNS));
+
+    //Fill in all 8 directions
+    Ops::V moves = movesInDirection<1>(p, masked);
+    moves = Ops::orOp(moves, movesInDirection<-1>(p, masked));
+    moves = Ops::orOp(moves, movesInDirection<8>(p, o));
+    moves = Ops::orOp(moves, movesInDirection<-8>(p, o));
+    moves = Ops::orOp(moves, movesInDirection<9>(p, masked));
+    moves = Ops::orOp(moves, movesInDirection<-9>(p, masked));
+    moves = Ops::orOp(moves, movesInDirection<-7>(p, masked));
+    moves = Ops::orOp(moves, movesInDirection<7>(p, masked));
+
+    //Only empty tiles can be moved to
+    Ops::store(out, Ops::andNot(Ops::orOp(p, o), Ops::andOp(moves, Ops::set1(bitboard::VALID_TILES))));
+}
+
+
+////////////////////////////////////////////////////////////////
+/// \brief Kernel to calculate the weighted disk counts of
+///        Ops::WIDTH boards, for the player to move
+///
+////////////////////////////////////////////////////////////////
+inline void weightedCountKernel(const bitboard_t* players, const bitboard_t* opponents, const bitboard_t* masks,
+        const int64_t* weights, const std::size_t& numGroups, int64_t* out)
+{
+    const Ops::V p = Ops::load(players);
+    const Ops::V o = Ops::load(opponents);
+
+    //Add up the difference in the number of disks in each group
+    Ops::V sum = Ops::set1(0);
+    for (std::size_t g = 0; g < numGroups; ++g)
+    {
+        const Ops::V mask = Ops::set1(masks[g]);
+        const Ops::V diff = Ops::sub(Ops::popCount(Ops::andOp(p, mask)), Ops::popCount(Ops::andOp(o, mask)));
+        sum = Ops::add(sum, Ops::mul(diff, weights[g]));
+    }
+
+    Ops::store(reinterpret_cast<bitboard_t*>(out), sum);
+}
+
+
+////////////////////////////////////////////////////////////////
+/// \brief Kernel to make one move on each of Ops::WIDTH boards
+///
+/// The disks of the player to move and their opponent are
+/// swapped, as it's the opponent's turn next
+///
+////////////////////////////////////////////////////////////////
+inline void makeMoveKernel(bitboard_t* players, bitboard_t* opponents, const bitboard_t* moves)
+{
+    const Ops::V m = Ops::load(moves);
+    const Ops::V p = Ops::load(players);
+    const Ops::V o = Ops::load(opponents);
+    const Ops::V masked = Ops::andOp(o, Ops::set1(NOT_EDGE_COLUMNS));
+
+    //Flip in all 8 directions
+    Ops::V flips = flipsInDirection<1>(m, p, masked);
+    flips = Ops::orOp(flips, flipsInDirection<-1>(m, p, masked));
+    flips = Ops::orOp(flips, flipsInDirection<8>(m, p, o));
+    flips = Ops::orOp(flips, flipsInDirection<-8>(m, p, o));
+    flips = Ops::orOp(flips, flipsInDirection<9>(m, p, masked));
+    flips = Ops::orOp(flips, flipsInDirection<-9>(m, p, masked));
+    flips = Ops::orOp(flips, flipsInDirection<-7>(m, p, masked));
+    flips = Ops::orOp(flips, flipsInDirection<7>(m, p, masked));
+
+    Ops::store(players, Ops::xorOp(o, flips));
+    Ops::store(opponents, Ops::orOp(Ops::xorOp(p, flips), m));
+}
+
+
+////////////////////////////////////////////////////////////////
+/// \brief Function to calculate the legal moves of the boards
+///        from first to last, Ops::WIDTH at a time
+///
+/// \return The index of the first board that is left over (less
+///         than Ops::WIDTH boards from the end)
+///
+////////////////////////////////////////////////////////////////
+inline std::size_t legalMovesRange(const bitboard_t* players, const bitboard_t* opponents, bitboard_t* out,
+        std::size_t first, const std::size_t& last)
+{
+    for (; first + Ops::WIDTH <= last; first += Ops::WIDTH)
+    {
+        legalMovesKernel(&players[first], &opponents[first], &out[first]);
+    }
+    return first;
+}
+
+
+////////////////////////////////////////////////////////////////
+/// \brief Function to calculate the weighted disk counts of the
+///        boards from first to last, Ops::WIDTH at a time
+///
+/// \return The index of the first board that is left over (less
+///         than Ops::WIDTH boards from the end)
+///
+////////////////////////////////////////////////////////////////
+inline std::size_t weightedCountsRange(const bitboard_t* players, const bitboard_t* opponents,
+        const bitboard_t* masks, const int64_t* weights, const std::size_t& numGroups, int64_t* out,
+        std::size_t first, const std::size_t& last)
+{
+    for (; first + Ops::WIDTH <= last; first += Ops::WIDTH)
+    {
+        weightedCountKernel(&players[first], &opponents[first], masks, weights, numGroups, &out[first]);
+    }
+    return first;
+}
+
+
+////////////////////////////////////////////////////////////////
+/// \brief Function to make one move on each of the boards from
+///        first to last, Ops::WIDTH at a time
+///
+/// \return The index of the first board that is left over (less
+///         than Ops::WIDTH boards from the end)
+///
+////////////////////////////////////////////////////////////////
+inline std::size_t makeMovesRange(bitboard_t* players, bitboard_t* opponents, const bitboard_t* moves,
+        std::size_t first, const std::size_t& last)
+{
+    for (; first + Ops::WIDTH <= last; first += Ops::WIDTH)
+    {
+        makeMoveKernel(&players[first], &opponents[first], &moves[first]);
+    }
+    return first;
+}
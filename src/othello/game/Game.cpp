@@ -33,6 +33,14 @@ namespace othello
         }
     
     
+        ////////////////////////////////////////////////////////////////
+        void Game::setAdjudicator(const std::shared_ptr<IPlayer>& adj, const uint8_t& empties)
+        {
+            adjudicator = adj;
+            adjudicationEmpties = empties;
+        }
+    
+    
         ////////////////////////////////////////////////////////////////
         void Game::setBoard(const Board& b) {board = b;}
         
@@ -54,13 +62,16 @@ namespace othello
             }
     
             //Get the possible turns
-            const std::vector<Move>& possibleMoves = board.getPossibleMoves();
+            MoveList possibleMoves;
+            board.getPossibleMoves(possibleMoves);
             
-            //Ask the player to make a move
-            const Move* move = players[board.getCurrentPlayer()]->makeMove(
-                    *this, board.getCurrentPlayer(), possibleMoves);
+            //Ask the player to make a move (or the adjudicator, near the end)
+            IPlayer& mover = adjudicator && bitboard::popCount(board.getEmptyTiles()) <= adjudicationEmpties ?
+                             *adjudicator : *players[board.getCurrentPlayer()];
+            const Move* move = mover.makeMove(*this, board.getCurrentPlayer(), possibleMoves);
             //Make the move on the board
-            const bool result = board.makeMove(move);
+            board.makeMove(move);
+            const bool result = board.isOver();
     
             //Increase the game length
             ++gameLength;
@@ -111,7 +122,7 @@ namespace othello
     
     
         ////////////////////////////////////////////////////////////////
-        const std::pair<uint8_t, uint8_t>& Game::getScore() const {return board.getScore();}
+        std::pair<uint8_t, uint8_t> Game::getScore() const {return board.getScore();}
     
     
         ////////////////////////////////////////////////////////////////
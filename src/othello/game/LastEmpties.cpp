@@ -0,0 +1,157 @@
+//Standard C++:
+#include <stdexcept>
+//Othello headers:
+#include <othello/game/LastEmpties.hpp>
+#include <othello/game/MoveGenerator.hpp>
+#include <othello/game/PositionFeatures.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        namespace
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief A value lower than any final disk difference
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr int NO_VALUE = -Board::BOARD_SIZE * Board::BOARD_SIZE - 1;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the disk difference of a player
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline int getDiskDifference(const bitboard_t& player, const bitboard_t& opponent)
+            {
+                return int(bitboard::popCount(player)) - int(bitboard::popCount(opponent));
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to solve a position with N empty tiles
+            ///
+            /// \param squares The bit indexes of the empty tiles, in the
+            ///        order to try them
+            /// \param passed Whether the other player just passed, so the
+            ///        game is over if this player can't move either
+            ///
+            ////////////////////////////////////////////////////////////////
+            template<uint8_t N>
+            int solveEmpties(const bitboard_t& player, const bitboard_t& opponent, int alpha, const int& beta,
+                    const uint8_t* squares, const bool& passed, uint64_t& nodes);
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to solve a position with 1 empty tile, by
+            ///        counting what either player would flip there
+            ///
+            ////////////////////////////////////////////////////////////////
+            template<>
+            int solveEmpties<1>(const bitboard_t& player, const bitboard_t& opponent, int, const int&,
+                    const uint8_t* squares, const bool&, uint64_t& nodes)
+            {
+                ++nodes;
+                const int difference = getDiskDifference(player, opponent);
+
+                //The player places a disk and flips some, or else the other
+                //player does, or else the tile stays empty
+                const uint8_t flips = LastEmpties::countFlips(player, opponent, squares[0]);
+                if (flips) {return difference + 2 * flips + 1;}
+                const uint8_t opponentFlips = LastEmpties::countFlips(opponent, player, squares[0]);
+                if (opponentFlips) {return difference - 2 * opponentFlips - 1;}
+                return difference;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            template<uint8_t N>
+            int solveEmpties(const bitboard_t& player, const bitboard_t& opponent, int alpha, const int& beta,
+                    const uint8_t* squares, const bool& passed, uint64_t& nodes)
+            {
+                ++nodes;
+
+                int best = NO_VALUE;
+                for (uint8_t i = 0; i < N; ++i)
+                {
+                    const bitboard_t flips = MoveGenerator::getFlips(player, opponent, squares[i]);
+                    if (!flips) {continue;}
+
+                    //The other empty tiles, in the same order
+                    uint8_t rest[N - 1];
+                    for (uint8_t j = 0, k = 0; j < N; ++j)
+                    {
+                        if (j != i) {rest[k++] = squares[j];}
+                    }
+
+                    const int value = -solveEmpties<N - 1>(opponent ^ flips, player | flips | bitboard::toBit(squares[i]),
+                                                           -beta, -alpha, rest, false, nodes);
+                    if (value > best)
+                    {
+                        best = value;
+                        if (value > alpha) {alpha = value;}
+                        if (alpha >= beta) {break;}
+                    }
+                }
+
+                //If the player can't move, the other player moves or the game ends
+                if (best == NO_VALUE)
+                {
+                    if (passed) {return getDiskDifference(player, opponent);}
+                    return -solveEmpties<N>(opponent, player, -beta, -alpha, squares, true, nodes);
+                }
+                return best;
+            }
+
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        constexpr uint8_t LastEmpties::MAX_EMPTIES;
+
+
+        ////////////////////////////////////////////////////////////////
+        uint8_t LastEmpties::countFlips(const bitboard_t& player, const bitboard_t& opponent, const uint8_t& index)
+        {
+            return bitboard::popCount(MoveGenerator::getFlips(player, opponent, index));
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        int LastEmpties::solve(const bitboard_t& player, const bitboard_t& opponent, const int& alpha, const int& beta,
+                uint64_t& nodes)
+        {
+            const bitboard_t empty = ~(player | opponent) & bitboard::VALID_TILES;
+            const uint8_t numEmpty = bitboard::popCount(empty);
+            if (numEmpty > MAX_EMPTIES) {throw std::invalid_argument("Too many empty tiles to solve");}
+
+            //Put the tiles in quadrants with an odd number of empty tiles first
+            bitboard_t odd = 0;
+            for (const bitboard_t& quadrant : PositionFeatures::QUADRANTS)
+            {
+                if (bitboard::popCount(empty & quadrant) & 1u) {odd |= quadrant;}
+            }
+            uint8_t squares[MAX_EMPTIES];
+            uint8_t count = 0;
+            for (bitboard_t tiles = empty & odd; tiles;) {squares[count++] = bitboard::popLowest(tiles);}
+            for (bitboard_t tiles = empty & ~odd; tiles;) {squares[count++] = bitboard::popLowest(tiles);}
+
+            switch (numEmpty)
+            {
+                case 1: return solveEmpties<1>(player, opponent, alpha, beta, squares, false, nodes);
+                case 2: return solveEmpties<2>(player, opponent, alpha, beta, squares, false, nodes);
+                case 3: return solveEmpties<3>(player, opponent, alpha, beta, squares, false, nodes);
+                case 4: return solveEmpties<4>(player, opponent, alpha, beta, squares, false, nodes);
+                default:
+                    ++nodes;
+                    return getDiskDifference(player, opponent);
+            }
+        }
+
+    }
+
+}
@@ -0,0 +1,392 @@
+//Othello headers:
+#include <othello/game/MoveGenerator.hpp>
+#include <othello/util/CpuFeatures.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        namespace
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Mask of every tile that isn't in the left-most or
+            ///        right-most column
+            ///
+            /// Masking the opponent's disks with this stops horizontal and
+            /// diagonal fills from wrapping around to the next row
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr bitboard_t NOT_EDGE_COLUMNS = 0x7E7E7E7E7E7E7E7EULL;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to shift a bitboard one step in a direction
+            ///
+            /// A positive S shifts towards the bottom-right (higher bit
+            /// indexes), a negative S shifts towards the top-left
+            ///
+            ////////////////////////////////////////////////////////////////
+            template<int S>
+            inline bitboard_t shift(const bitboard_t& bb)
+            {
+                return S > 0 ? bb << (S > 0 ? S : 0) : bb >> (S > 0 ? 0 : -S);
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Kogge-Stone occluded fill of gen through pro in the
+            ///        direction S
+            ///
+            /// \return gen plus every tile in pro that is connected to gen
+            ///         by an unbroken line of pro tiles in direction S
+            ///
+            ////////////////////////////////////////////////////////////////
+            template<int S>
+            inline bitboard_t fill(bitboard_t gen, bitboard_t pro)
+            {
+                gen |= pro & shift<S>(gen);
+                pro &= shift<S>(pro);
+                gen |= pro & shift<2 * S>(gen);
+                pro &= shift<2 * S>(pro);
+                gen |= pro & shift<4 * S>(gen);
+                return gen;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the tiles one step past the runs of
+            ///        opponent disks that start next to the player's disks
+            ///
+            ////////////////////////////////////////////////////////////////
+            template<int S>
+            inline bitboard_t movesInDirection(const bitboard_t& player, const bitboard_t& pro)
+            {
+                return shift<S>(fill<S>(player, pro) ^ player);
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The A column (left-most tiles) of the board
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr bitboard_t COLUMN_A = 0x0101010101010101ULL;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Multiplier that gathers the A column into the top
+            ///        byte (row y goes to bit 56 + y)
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr bitboard_t COLUMN_A_TO_ROW = 0x0102040810204080ULL;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \struct FlipTables
+            ///
+            /// \brief Struct containing the lookup tables used to calculate
+            ///        flipped disks
+            ///
+            /// A line (row, column or diagonal) through the placed disk is
+            /// reduced to 8 bits per player. outflank gives, for the placed
+            /// disk's position in the line and the opponent's line bits,
+            /// the tiles just past each run of opponent disks that touches
+            /// the placed disk. Masked with the player's line bits this
+            /// leaves the outflanking disks, and flipped gives the tiles
+            /// between them and the placed disk
+            ///
+            ////////////////////////////////////////////////////////////////
+            struct FlipTables
+            {
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The outflanking tiles, indexed by [position][opponent]
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint8_t outflank[8][256];
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The flipped tiles, indexed by [position][outflank]
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint8_t flipped[8][256];
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief 8 line bits spread over the A column (bit y goes to
+                ///        tile (0, y)), used to put flipped column tiles back
+                ///
+                ////////////////////////////////////////////////////////////////
+                bitboard_t columnDeposit[256];
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The diagonal (top-left to bottom-right) through each
+                ///        tile
+                ///
+                ////////////////////////////////////////////////////////////////
+                bitboard_t diagonal[64];
+                
+                
+                ////////////////////////////////////////////////////////////////
+                /// \brief The anti-diagonal (top-right to bottom-left) through
+                ///        each tile
+                ///
+                ////////////////////////////////////////////////////////////////
+                bitboard_t antiDiagonal[64];
+                
+            };
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to build the flip tables at compile time
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr FlipTables makeFlipTables()
+            {
+                FlipTables tables{};
+                
+                for (int pos = 0; pos < 8; ++pos)
+                {
+                    for (int line = 0; line < 256; ++line)
+                    {
+                        //Walk along the run of opponent disks on each side
+                        int outflank = 0;
+                        int i = pos + 1;
+                        while (i < 8 && (line & (1 << i))) {++i;}
+                        if (i > pos + 1 && i < 8) {outflank |= 1 << i;}
+                        i = pos - 1;
+                        while (i >= 0 && (line & (1 << i))) {--i;}
+                        if (i < pos - 1 && i >= 0) {outflank |= 1 << i;}
+                        tables.outflank[pos][line] = static_cast<uint8_t>(outflank);
+                        
+                        //Flip everything between the placed disk and the nearest outflanking
+                        //disk on each side (here the line bits are the outflanking disks)
+                        int flipped = 0;
+                        for (i = pos + 1; i < 8 && !(line & (1 << i)); ++i) {}
+                        if (i < 8) {for (int j = pos + 1; j < i; ++j) {flipped |= 1 << j;}}
+                        for (i = pos - 1; i >= 0 && !(line & (1 << i)); --i) {}
+                        if (i >= 0) {for (int j = pos - 1; j > i; --j) {flipped |= 1 << j;}}
+                        tables.flipped[pos][line] = static_cast<uint8_t>(flipped);
+                    }
+                }
+                
+                for (int line = 0; line < 256; ++line)
+                {
+                    for (int y = 0; y < 8; ++y)
+                    {
+                        if (line & (1 << y)) {tables.columnDeposit[line] |= bitboard::toBit(y * 8);}
+                    }
+                }
+                
+                for (int index = 0; index < 64; ++index)
+                {
+                    const int x = index % 8;
+                    const int y = index / 8;
+                    for (int i = 0; i < 64; ++i)
+                    {
+                        if (i % 8 - i / 8 == x - y) {tables.diagonal[index] |= bitboard::toBit(i);}
+                        if (i % 8 + i / 8 == x + y) {tables.antiDiagonal[index] |= bitboard::toBit(i);}
+                    }
+                }
+                
+                return tables;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The flip tables
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr FlipTables FLIP_TABLES = makeFlipTables();
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the flipped tiles of a single line
+            ///
+            /// \param pos The position of the placed disk in the line
+            /// \param player The player's line bits
+            /// \param opponent The opponent's line bits
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline uint8_t flipLine(const uint8_t& pos, const uint8_t& player, const uint8_t& opponent)
+            {
+                return FLIP_TABLES.flipped[pos][FLIP_TABLES.outflank[pos][opponent] & player];
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to gather the tiles of a diagonal into 8 bits
+            ///        (tile (x, y) goes to bit x)
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline uint8_t gatherDiagonal(const bitboard_t& bb, const bitboard_t& diagonal)
+            {
+                //Each column has at most one tile of the diagonal, so multiplying
+                //by the A column adds every row into the top byte without carries
+                return static_cast<uint8_t>(((bb & diagonal) * COLUMN_A) >> 56);
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to gather the tiles of a column into 8 bits
+            ///        (tile (x, y) goes to bit y)
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline uint8_t gatherColumn(const bitboard_t& bb, const uint8_t& x)
+            {
+                return static_cast<uint8_t>((((bb >> x) & COLUMN_A) * COLUMN_A_TO_ROW) >> 56);
+            }
+
+
+            #ifdef OTHELLO_X86_KERNELS
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the flipped tiles of the line `mask`
+            ///        through the tile `index` using PEXT and PDEP
+            ///
+            ////////////////////////////////////////////////////////////////
+            OTHELLO_TARGET("bmi2") inline bitboard_t flipLineBMI2(const bitboard_t& player, const bitboard_t& opponent,
+                    const uint8_t& index, const bitboard_t& mask)
+            {
+                const uint8_t pos = bitboard::popCount(mask & (bitboard::toBit(index) - 1));
+                return _pdep_u64(flipLine(pos, static_cast<uint8_t>(_pext_u64(player, mask)),
+                        static_cast<uint8_t>(_pext_u64(opponent, mask))), mask);
+            }
+            #endif
+
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        bitboard_t MoveGenerator::getLegalMovesScalar(const bitboard_t& player, const bitboard_t& opponent)
+        {
+            const bitboard_t masked = opponent & NOT_EDGE_COLUMNS;
+
+            //Fill in all 8 directions
+            bitboard_t moves = movesInDirection<1>(player, masked); //right
+            moves |= movesInDirection<-1>(player, masked); //left
+            moves |= movesInDirection<8>(player, opponent); //down
+            moves |= movesInDirection<-8>(player, opponent); //up
+            moves |= movesInDirection<9>(player, masked); //down-right
+            moves |= movesInDirection<-9>(player, masked); //up-left
+            moves |= movesInDirection<-7>(player, masked); //up-right
+            moves |= movesInDirection<7>(player, masked); //down-left
+
+            //Only empty tiles can be moved to
+            return moves & ~(player | opponent) & bitboard::VALID_TILES;
+        }
+
+
+        #ifdef OTHELLO_X86_KERNELS
+        ////////////////////////////////////////////////////////////////
+        OTHELLO_TARGET("avx2") bitboard_t MoveGenerator::getLegalMovesAVX2(const bitboard_t& player, const bitboard_t& opponent)
+        {
+            const bitboard_t masked = opponent & NOT_EDGE_COLUMNS;
+
+            //One direction per lane: down, right, down-right and down-left when
+            //shifting left, and up, left, up-left and up-right when shifting right
+            const __m256i shift1 = _mm256_set_epi64x(7, 9, 1, 8);
+            const __m256i shift2 = _mm256_add_epi64(shift1, shift1);
+            const __m256i shift4 = _mm256_add_epi64(shift2, shift2);
+            const __m256i p = _mm256_set1_epi64x(static_cast<long long>(player));
+            const __m256i pro = _mm256_set_epi64x(static_cast<long long>(masked), static_cast<long long>(masked),
+                                                  static_cast<long long>(masked), static_cast<long long>(opponent));
+
+            //Fill towards the higher bit indexes
+            __m256i gen = _mm256_or_si256(p, _mm256_and_si256(pro, _mm256_sllv_epi64(p, shift1)));
+            __m256i pr = _mm256_and_si256(pro, _mm256_sllv_epi64(pro, shift1));
+            gen = _mm256_or_si256(gen, _mm256_and_si256(pr, _mm256_sllv_epi64(gen, shift2)));
+            pr = _mm256_and_si256(pr, _mm256_sllv_epi64(pr, shift2));
+            gen = _mm256_or_si256(gen, _mm256_and_si256(pr, _mm256_sllv_epi64(gen, shift4)));
+            __m256i moves = _mm256_sllv_epi64(_mm256_xor_si256(gen, p), shift1);
+
+            //Fill towards the lower bit indexes
+            gen = _mm256_or_si256(p, _mm256_and_si256(pro, _mm256_srlv_epi64(p, shift1)));
+            pr = _mm256_and_si256(pro, _mm256_srlv_epi64(pro, shift1));
+            gen = _mm256_or_si256(gen, _mm256_and_si256(pr, _mm256_srlv_epi64(gen, shift2)));
+            pr = _mm256_and_si256(pr, _mm256_srlv_epi64(pr, shift2));
+            gen = _mm256_or_si256(gen, _mm256_and_si256(pr, _mm256_srlv_epi64(gen, shift4)));
+            moves = _mm256_or_si256(moves, _mm256_srlv_epi64(_mm256_xor_si256(gen, p), shift1));
+
+            //Combine the four lanes
+            __m128i combined = _mm_or_si128(_mm256_castsi256_si128(moves), _mm256_extracti128_si256(moves, 1));
+            combined = _mm_or_si128(combined, _mm_unpackhi_epi64(combined, combined));
+
+            //Only empty tiles can be moved to
+            return static_cast<bitboard_t>(_mm_cvtsi128_si64(combined)) & ~(player | opponent) &
+                   bitboard::VALID_TILES;
+        }
+        #endif
+
+
+        ////////////////////////////////////////////////////////////////
+        bitboard_t MoveGenerator::getLegalMoves(const bitboard_t& player, const bitboard_t& opponent)
+        {
+            #ifdef OTHELLO_X86_KERNELS
+            if (util::CpuFeatures::isEnabled(util::CpuFeatures::AVX2)) {return getLegalMovesAVX2(player, opponent);}
+            #endif
+            return getLegalMovesScalar(player, opponent);
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        bitboard_t MoveGenerator::getFlipsTables(const bitboard_t& player, const bitboard_t& opponent,
+                const uint8_t& index)
+        {
+            const uint8_t x = index % bitboard::ROW_SIZE;
+            const uint8_t y = index / bitboard::ROW_SIZE;
+            
+            //Row
+            const uint8_t rowShift = y * bitboard::ROW_SIZE;
+            bitboard_t flips = static_cast<bitboard_t>(flipLine(x, static_cast<uint8_t>(player >> rowShift),
+                    static_cast<uint8_t>(opponent >> rowShift))) << rowShift;
+            
+            //Column
+            flips |= FLIP_TABLES.columnDeposit[flipLine(y, gatherColumn(player, x), gatherColumn(opponent, x))] << x;
+            
+            //Diagonals (multiplying by the A column copies the line bits into
+            //every row, and the diagonal mask picks one per column)
+            const bitboard_t diagonal = FLIP_TABLES.diagonal[index];
+            flips |= (flipLine(x, gatherDiagonal(player, diagonal), gatherDiagonal(opponent, diagonal)) * COLUMN_A) &
+                     diagonal;
+            const bitboard_t antiDiagonal = FLIP_TABLES.antiDiagonal[index];
+            flips |= (flipLine(x, gatherDiagonal(player, antiDiagonal), gatherDiagonal(opponent, antiDiagonal)) *
+                      COLUMN_A) & antiDiagonal;
+            
+            return flips;
+        }
+
+
+        #ifdef OTHELLO_X86_KERNELS
+        ////////////////////////////////////////////////////////////////
+        OTHELLO_TARGET("bmi2") bitboard_t MoveGenerator::getFlipsBMI2(const bitboard_t& player, const bitboard_t& opponent,
+                const uint8_t& index)
+        {
+            const uint8_t x = index % bitboard::ROW_SIZE;
+            const uint8_t y = index / bitboard::ROW_SIZE;
+            
+            return flipLineBMI2(player, opponent, index, 0xFFULL << (y * bitboard::ROW_SIZE)) |
+                   flipLineBMI2(player, opponent, index, COLUMN_A << x) |
+                   flipLineBMI2(player, opponent, index, FLIP_TABLES.diagonal[index]) |
+                   flipLineBMI2(player, opponent, index, FLIP_TABLES.antiDiagonal[index]);
+        }
+        #endif
+
+
+        ////////////////////////////////////////////////////////////////
+        bitboard_t MoveGenerator::getFlips(const bitboard_t& player, const bitboard_t& opponent,
+                const uint8_t& index)
+        {
+            #ifdef OTHELLO_X86_KERNELS
+            if (util::CpuFeatures::isEnabled(util::CpuFeatures::BMI2)) {return getFlipsBMI2(player, opponent, index);}
+            #endif
+            return getFlipsTables(player, opponent, index);
+        }
+
+    }
+
+}
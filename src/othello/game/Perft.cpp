@@ -0,0 +1,218 @@
+//Standard C++:
+#include <atomic>
+#include <thread>
+//Othello headers:
+#include <othello/game/Perft.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        namespace
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \class PerftTable
+            ///
+            /// \brief Direct-mapped hash table of subtree leaf counts
+            ///
+            /// Entries store the full position, so a hash collision can
+            /// never give a wrong count
+            ///
+            ////////////////////////////////////////////////////////////////
+            class PerftTable
+            {
+                private:
+
+                    ////////////////////////////////////////////////////////////////
+                    /// \brief An entry in the table
+                    ///
+                    ////////////////////////////////////////////////////////////////
+                    struct Entry
+                    {
+                        std::array<bitboard_t, 2> disks;
+                        uint64_t count;
+                        uint8_t player;
+                        uint8_t depth;
+                    };
+
+
+                    ////////////////////////////////////////////////////////////////
+                    /// \brief The entries (a power of 2 in size, or empty)
+                    ///
+                    ////////////////////////////////////////////////////////////////
+                    std::vector<Entry> entries;
+
+
+                public:
+
+                    ////////////////////////////////////////////////////////////////
+                    /// \brief Class constructor
+                    ///
+                    /// \param size The maximum size of the table in bytes
+                    ///
+                    ////////////////////////////////////////////////////////////////
+                    explicit PerftTable(const std::size_t& size)
+                    {
+                        //Round the number of entries down to a power of 2
+                        std::size_t numEntries = 1;
+                        while (numEntries * 2 * sizeof(Entry) <= size) {numEntries *= 2;}
+                        if (numEntries * sizeof(Entry) <= size) {entries.resize(numEntries, Entry{{}, 0, 0, 0});}
+                    }
+
+
+                    ////////////////////////////////////////////////////////////////
+                    /// \brief Function to get the entry a position is stored in
+                    ///
+                    /// \warning The table mustn't be empty
+                    ///
+                    ////////////////////////////////////////////////////////////////
+                    Entry& getEntry(const Board& board)
+                    {
+                        return entries[board.getHash() & (entries.size() - 1)];
+                    }
+
+
+                    ////////////////////////////////////////////////////////////////
+                    /// \brief Function to find the count of a position
+                    ///
+                    /// \return Whether the count was found
+                    ///
+                    ////////////////////////////////////////////////////////////////
+                    bool probe(const Board& board, const uint8_t& depth, uint64_t& count)
+                    {
+                        if (entries.empty()) {return false;}
+                        
+                        const Entry& entry = getEntry(board);
+                        if (entry.depth != depth || entry.player != board.getCurrentPlayer() ||
+                            entry.disks[0] != board.getDisks(0) || entry.disks[1] != board.getDisks(1))
+                        {
+                            return false;
+                        }
+                        
+                        count = entry.count;
+                        return true;
+                    }
+
+
+                    ////////////////////////////////////////////////////////////////
+                    /// \brief Function to store the count of a position
+                    ///        (always replacing the old entry)
+                    ///
+                    ////////////////////////////////////////////////////////////////
+                    void store(const Board& board, const uint8_t& depth, const uint64_t& count)
+                    {
+                        if (entries.empty()) {return;}
+                        getEntry(board) = {{board.getDisks(0), board.getDisks(1)}, count,
+                                           board.getCurrentPlayer(), depth};
+                    }
+            };
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to count the leaves below a position,
+            ///        making and undoing the moves on the board
+            ///
+            ////////////////////////////////////////////////////////////////
+            uint64_t perft(Board& board, const uint8_t& depth, PerftTable& table)
+            {
+                //A finished game is a leaf however deep it is
+                if (depth == 0 || board.isTerminal()) {return 1;}
+                
+                //Every move at the last level is a leaf, so there's no need to
+                //make them
+                if (depth == 1) {return bitboard::popCount(board.getLegalMoves());}
+                
+                //Check if the subtree was already counted
+                uint64_t count = 0;
+                if (table.probe(board, depth, count)) {return count;}
+                
+                //Iterate over the possible moves
+                const uint8_t player = board.getCurrentPlayer();
+                bitboard_t possibleMoves = board.getLegalMoves();
+                while (possibleMoves)
+                {
+                    const UndoRecord undo = board.applyMove(board.createMove(bitboard::popLowest(possibleMoves)));
+                    
+                    //If it's still the player's turn, the other player passed,
+                    //which takes up a move
+                    if (board.getCurrentPlayer() == player && !board.isTerminal())
+                    {
+                        count += perft(board, depth - 2, table);
+                    }
+                    else {count += perft(board, depth - 1, table);}
+                    
+                    board.undoMove(undo);
+                }
+                
+                table.store(board, depth, count);
+                return count;
+            }
+
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        std::vector<std::pair<uint8_t, uint64_t> > Perft::divide(const Board& board, const uint8_t& depth,
+                const unsigned int& numThreads, const std::size_t& hashSize)
+        {
+            std::vector<std::pair<uint8_t, uint64_t> > results;
+            if (depth == 0 || board.isTerminal()) {return results;}
+            
+            //Create a result for each root move
+            bitboard_t possibleMoves = board.getLegalMoves();
+            while (possibleMoves) {results.emplace_back(bitboard::popLowest(possibleMoves), 0);}
+            
+            //The index of the next root move to count
+            std::atomic<std::size_t> nextMove{0};
+            
+            //Lambda for a thread to count root moves until there are none left
+            auto countMoves = [&]()
+            {
+                //Each thread has its own board and table
+                Board tmpBoard = board;
+                PerftTable table(hashSize);
+                
+                for (std::size_t i = nextMove++; i < results.size(); i = nextMove++)
+                {
+                    const UndoRecord undo = tmpBoard.applyMove(tmpBoard.createMove(results[i].first));
+                    
+                    //Count the passes in the same way as perft
+                    if (tmpBoard.getCurrentPlayer() == board.getCurrentPlayer() && !tmpBoard.isTerminal())
+                    {
+                        results[i].second = depth == 1 ? 1 : perft(tmpBoard, depth - 2, table);
+                    }
+                    else {results[i].second = perft(tmpBoard, depth - 1, table);}
+                    
+                    tmpBoard.undoMove(undo);
+                }
+            };
+            
+            //Start the extra threads and count in this thread too
+            std::vector<std::thread> threads;
+            for (unsigned int i = 1; i < numThreads; ++i) {threads.emplace_back(countMoves);}
+            countMoves();
+            for (auto& thread : threads) {thread.join();}
+            
+            return results;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        uint64_t Perft::count(const Board& board, const uint8_t& depth,
+                const unsigned int& numThreads, const std::size_t& hashSize)
+        {
+            if (depth == 0 || board.isTerminal()) {return 1;}
+            
+            //Add up the counts of the root moves
+            uint64_t total = 0;
+            for (const auto& result : divide(board, depth, numThreads, hashSize)) {total += result.second;}
+            return total;
+        }
+
+    }
+
+}
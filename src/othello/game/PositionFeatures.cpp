@@ -0,0 +1,82 @@
+//Othello headers:
+#include <othello/game/PositionFeatures.hpp>
+#include <othello/game/MoveGenerator.hpp>
+#include <othello/game/Stability.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        ////////////////////////////////////////////////////////////////
+        constexpr bitboard_t PositionFeatures::QUADRANTS[4];
+
+
+        ////////////////////////////////////////////////////////////////
+        uint8_t PositionFeatures::getMobility(const Board& board, const uint8_t& player)
+        {
+            //The board already has the current player's moves
+            if (player == board.getCurrentPlayer()) {return bitboard::popCount(board.getLegalMoves());}
+            return bitboard::popCount(MoveGenerator::getLegalMoves(board.getDisks(player), board.getDisks(!player)));
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        uint8_t PositionFeatures::getFrontier(const Board& board, const uint8_t& player)
+        {
+            return bitboard::popCount(board.getDisks(player) & bitboard::getNeighbours(board.getEmptyTiles()));
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        uint8_t PositionFeatures::getPotentialMobility(const Board& board, const uint8_t& player)
+        {
+            return bitboard::popCount(board.getEmptyTiles() & bitboard::getNeighbours(board.getDisks(!player)));
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        uint8_t PositionFeatures::getParity(const Board& board)
+        {
+            const bitboard_t empty = board.getEmptyTiles();
+            uint8_t parity = 0;
+            for (uint8_t q = 0; q < 4; ++q) {parity |= (bitboard::popCount(empty & QUADRANTS[q]) & 1) << q;}
+            return parity;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        uint8_t PositionFeatures::getStability(const Board& board, const uint8_t& player)
+        {
+            return Stability::getStableDiskCount(board, player);
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        PositionFeatures::Features PositionFeatures::getFeatures(const Board& board)
+        {
+            Features features{};
+            
+            //The neighbours of the empty tiles are shared by both players'
+            //frontiers
+            const bitboard_t empty = board.getEmptyTiles();
+            const bitboard_t emptyNeighbours = bitboard::getNeighbours(empty);
+            
+            for (uint8_t p = 0; p < 2; ++p)
+            {
+                features.mobility[p] = getMobility(board, p);
+                features.frontier[p] = bitboard::popCount(board.getDisks(p) & emptyNeighbours);
+                features.potentialMobility[p] = bitboard::popCount(empty & bitboard::getNeighbours(board.getDisks(!p)));
+                features.stable[p] = getStability(board, p);
+            }
+            
+            features.parity = getParity(board);
+            features.numEmpty = bitboard::popCount(empty);
+            return features;
+        }
+
+    }
+
+}
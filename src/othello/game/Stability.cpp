@@ -0,0 +1,363 @@
+//Othello headers:
+#include <othello/game/Stability.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        namespace
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to calculate a power of 3 at compile time
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr int pow3(const int& n) {return n == 0 ? 1 : 3 * pow3(n - 1);}
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The number of ways an edge can be filled (each tile is
+            ///        empty, the player's or the opponent's)
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr int EDGE_STATES = pow3(bitboard::BOARD_SIZE);
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The A column (left-most tiles) of the board
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr bitboard_t COLUMN_A = 0x0101010101010101ULL;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Multiplier that gathers the A column into the top
+            ///        byte (row y goes to bit 56 + y)
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr bitboard_t COLUMN_A_TO_ROW = 0x0102040810204080ULL;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \struct StabilityTables
+            ///
+            /// \brief Struct containing the lookup tables used to find
+            ///        stable disks
+            ///
+            /// An edge is stored as its line bits for each player, and is
+            /// looked up by `ternary[player] + 2 * ternary[opponent]`
+            ///
+            ////////////////////////////////////////////////////////////////
+            struct StabilityTables
+            {
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The line bits read as base 3 digits
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint16_t ternary[256];
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The player's stable disks on each edge configuration
+                ///
+                ////////////////////////////////////////////////////////////////
+                uint8_t edgeStable[EDGE_STATES];
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief 8 line bits spread over the A column (bit y goes to
+                ///        tile (0, y))
+                ///
+                ////////////////////////////////////////////////////////////////
+                bitboard_t columnDeposit[256];
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The tiles whose line in a direction leaves the board
+                ///        within 1, 2 and 4 steps, indexed by [axis][side][step]
+                ///
+                /// The axes are horizontal, vertical, diagonal and
+                /// anti-diagonal, and side 0 is towards the higher bit indexes
+                ///
+                ////////////////////////////////////////////////////////////////
+                bitboard_t lineEnds[4][2][3];
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief The tiles that aren't on an edge of the board
+                ///
+                ////////////////////////////////////////////////////////////////
+                bitboard_t inner;
+
+            };
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to place a disk on an edge and flip the disks
+            ///        it outflanks along the edge
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr void playOnEdge(int& mover, int& other, const int& x)
+            {
+                int flips = 0;
+
+                //Walk along the run of the other player's disks on each side
+                int i = x + 1;
+                while (i < bitboard::BOARD_SIZE && (other & (1 << i))) {++i;}
+                if (i > x + 1 && i < bitboard::BOARD_SIZE && (mover & (1 << i)))
+                {
+                    for (int j = x + 1; j < i; ++j) {flips |= 1 << j;}
+                }
+                i = x - 1;
+                while (i >= 0 && (other & (1 << i))) {--i;}
+                if (i < x - 1 && i >= 0 && (mover & (1 << i)))
+                {
+                    for (int j = x - 1; j > i; --j) {flips |= 1 << j;}
+                }
+
+                mover |= flips | (1 << x);
+                other &= ~flips;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to build the stability tables at compile time
+            ///
+            /// A disk on an edge is stable if it is still the player's after
+            /// any move on the edge, by either player, in any order. Every
+            /// move fills a tile, so the configurations are worked out from
+            /// full edges down to empty ones, and each one only looks up the
+            /// configurations one move later
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr StabilityTables makeStabilityTables()
+            {
+                StabilityTables tables{};
+                constexpr int size = bitboard::BOARD_SIZE;
+
+                for (int line = 0; line < 256; ++line)
+                {
+                    for (int i = 0; i < size; ++i)
+                    {
+                        if (line & (1 << i)) {tables.ternary[line] += pow3(i);}
+                    }
+                    for (int y = 0; y < size; ++y)
+                    {
+                        if (line & (1 << y)) {tables.columnDeposit[line] |= bitboard::toBit(y * bitboard::ROW_SIZE);}
+                    }
+                }
+
+                for (int numEmpty = 0; numEmpty <= size; ++numEmpty)
+                {
+                    for (int index = 0; index < EDGE_STATES; ++index)
+                    {
+                        //Read the line bits out of the base 3 digits
+                        int player = 0;
+                        int opponent = 0;
+                        int empty = 0;
+                        int count = 0;
+                        int digits = index;
+                        for (int i = 0; i < size; ++i, digits /= 3)
+                        {
+                            if (digits % 3 == 1) {player |= 1 << i;}
+                            else if (digits % 3 == 2) {opponent |= 1 << i;}
+                            else {empty |= 1 << i; ++count;}
+                        }
+                        if (count != numEmpty) {continue;}
+
+                        //Only keep the disks that stay the player's after every move
+                        int stable = player;
+                        for (int x = 0; x < size && stable; ++x)
+                        {
+                            if (!(empty & (1 << x))) {continue;}
+
+                            int mover = player;
+                            int other = opponent;
+                            playOnEdge(mover, other, x);
+                            stable &= tables.edgeStable[tables.ternary[mover] + 2 * tables.ternary[other]];
+
+                            mover = opponent;
+                            other = player;
+                            playOnEdge(mover, other, x);
+                            stable &= tables.edgeStable[tables.ternary[other] + 2 * tables.ternary[mover]];
+                        }
+                        tables.edgeStable[index] = static_cast<uint8_t>(stable);
+                    }
+                }
+
+                //The directions of the axes
+                const int dx[4] = {1, 0, 1, -1};
+                const int dy[4] = {0, 1, 1, 1};
+                for (int index = 0; index < 64; ++index)
+                {
+                    const int x = index % bitboard::ROW_SIZE;
+                    const int y = index / bitboard::ROW_SIZE;
+                    for (int axis = 0; axis < 4; ++axis)
+                    {
+                        for (int side = 0; side < 2; ++side)
+                        {
+                            const int sign = side ? -1 : 1;
+                            for (int step = 0; step < 3; ++step)
+                            {
+                                const int nx = x + sign * (1 << step) * dx[axis];
+                                const int ny = y + sign * (1 << step) * dy[axis];
+                                if (nx < 0 || ny < 0 || nx >= bitboard::ROW_SIZE || ny >= bitboard::ROW_SIZE)
+                                {
+                                    tables.lineEnds[axis][side][step] |= bitboard::toBit(index);
+                                }
+                            }
+                        }
+                    }
+
+                    if (x > 0 && y > 0 && x < size - 1 && y < size - 1) {tables.inner |= bitboard::toBit(index);}
+                }
+
+                return tables;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The stability tables
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr StabilityTables STABILITY_TABLES = makeStabilityTables();
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to move every tile S steps towards the lower
+            ///        bit indexes (or -S steps towards the higher bit indexes
+            ///        if S is negative)
+            ///
+            ////////////////////////////////////////////////////////////////
+            template<int S>
+            inline bitboard_t pull(const bitboard_t& bb)
+            {
+                return S > 0 ? bb >> (S > 0 ? S : 0) : bb << (S > 0 ? 0 : -S);
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the tiles that are followed by only
+            ///        full tiles up to the end of the board in the direction S
+            ///
+            /// \param ends The tiles whose line leaves the board within 1, 2
+            ///        and 4 steps in the direction S
+            ///
+            ////////////////////////////////////////////////////////////////
+            template<int S>
+            inline bitboard_t fullInDirection(const bitboard_t& occupied, const bitboard_t (&ends)[3])
+            {
+                bitboard_t full = occupied & (pull<S>(occupied) | ends[0]);
+                full &= pull<2 * S>(full) | ends[1];
+                full &= pull<4 * S>(full) | ends[2];
+                return full;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the tiles whose line along an axis is
+            ///        full
+            ///
+            ////////////////////////////////////////////////////////////////
+            template<int S>
+            inline bitboard_t fullLines(const bitboard_t& occupied, const uint8_t& axis)
+            {
+                return fullInDirection<S>(occupied, STABILITY_TABLES.lineEnds[axis][0]) &
+                       fullInDirection<-S>(occupied, STABILITY_TABLES.lineEnds[axis][1]);
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the stable disks of a single edge
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline uint8_t getEdgeStable(const uint8_t& player, const uint8_t& opponent)
+            {
+                return STABILITY_TABLES.edgeStable[STABILITY_TABLES.ternary[player] +
+                                                   2 * STABILITY_TABLES.ternary[opponent]];
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to gather the tiles of a column into 8 bits
+            ///        (tile (x, y) goes to bit y)
+            ///
+            ////////////////////////////////////////////////////////////////
+            inline uint8_t gatherColumn(const bitboard_t& bb, const uint8_t& x)
+            {
+                return static_cast<uint8_t>((((bb >> x) & COLUMN_A) * COLUMN_A_TO_ROW) >> 56);
+            }
+
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        bitboard_t Stability::getStableDisks(const bitboard_t& player, const bitboard_t& opponent)
+        {
+            constexpr uint8_t last = bitboard::BOARD_SIZE - 1;
+            constexpr uint8_t lastRow = last * bitboard::ROW_SIZE;
+
+            //Look up the 4 edges
+            bitboard_t stable = getEdgeStable(static_cast<uint8_t>(player), static_cast<uint8_t>(opponent));
+            stable |= static_cast<bitboard_t>(getEdgeStable(static_cast<uint8_t>(player >> lastRow),
+                    static_cast<uint8_t>(opponent >> lastRow))) << lastRow;
+            stable |= STABILITY_TABLES.columnDeposit[getEdgeStable(gatherColumn(player, 0), gatherColumn(opponent, 0))];
+            stable |= STABILITY_TABLES.columnDeposit[getEdgeStable(gatherColumn(player, last),
+                    gatherColumn(opponent, last))] << last;
+
+            //Find the full lines (the tiles off the board end lines like full
+            //tiles do)
+            const bitboard_t occupied = player | opponent | ~bitboard::VALID_TILES;
+            const bitboard_t horizontal = fullLines<1>(occupied, 0);
+            const bitboard_t vertical = fullLines<bitboard::ROW_SIZE>(occupied, 1);
+            const bitboard_t diagonal = fullLines<bitboard::ROW_SIZE + 1>(occupied, 2);
+            const bitboard_t antiDiagonal = fullLines<bitboard::ROW_SIZE - 1>(occupied, 3);
+
+            //Disks that are full in every direction can't be flipped
+            const bitboard_t inner = player & STABILITY_TABLES.inner;
+            stable |= inner & horizontal & vertical & diagonal & antiDiagonal;
+
+            //Add the disks that have a full line or a stable neighbour on
+            //every axis, until there are no more
+            bitboard_t previous = 0;
+            while (stable != previous)
+            {
+                previous = stable;
+                stable |= inner &
+                          (horizontal | (stable >> 1) | (stable << 1)) &
+                          (vertical | (stable >> bitboard::ROW_SIZE) | (stable << bitboard::ROW_SIZE)) &
+                          (diagonal | (stable >> (bitboard::ROW_SIZE + 1)) | (stable << (bitboard::ROW_SIZE + 1))) &
+                          (antiDiagonal | (stable >> (bitboard::ROW_SIZE - 1)) | (stable << (bitboard::ROW_SIZE - 1)));
+            }
+
+            return stable;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        uint8_t Stability::getStableDiskCount(const Board& board, const uint8_t& player)
+        {
+            return bitboard::popCount(getStableDisks(board.getDisks(player), board.getDisks(!player)));
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        int Stability::getScoreLowerBound(const Board& board, const uint8_t& player)
+        {
+            return 2 * getStableDiskCount(board, player) - Board::BOARD_SIZE * Board::BOARD_SIZE;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        int Stability::getScoreUpperBound(const Board& board, const uint8_t& player)
+        {
+            return Board::BOARD_SIZE * Board::BOARD_SIZE - 2 * getStableDiskCount(board, !player);
+        }
+
+    }
+
+}
@@ -0,0 +1,60 @@
+//Othello headers:
+#include <othello/game/Zobrist.hpp>
+
+
+namespace othello
+{
+
+    namespace game
+    {
+
+        namespace zobrist
+        {
+
+            namespace
+            {
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to step a SplitMix64 generator and return
+                ///        the next random number
+                ///
+                ////////////////////////////////////////////////////////////////
+                constexpr hash_t splitMix64(hash_t& state)
+                {
+                    hash_t z = (state += 0x9E3779B97F4A7C15ULL);
+                    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+                    return z ^ (z >> 31);
+                }
+
+
+                ////////////////////////////////////////////////////////////////
+                /// \brief Function to generate the keys at compile time
+                ///
+                ////////////////////////////////////////////////////////////////
+                constexpr Keys makeKeys()
+                {
+                    Keys keys{};
+                    hash_t state = 0x4F7468656C6C6F21ULL;
+                    
+                    for (int p = 0; p < 2; ++p)
+                    {
+                        for (int i = 0; i < 64; ++i) {keys.disks[p][i] = splitMix64(state);}
+                    }
+                    for (int i = 0; i < 64; ++i) {keys.flips[i] = keys.disks[0][i] ^ keys.disks[1][i];}
+                    keys.secondPlayer = splitMix64(state);
+                    
+                    return keys;
+                }
+
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            constexpr Keys KEYS = makeKeys();
+
+        }
+
+    }
+
+}
@@ -0,0 +1,112 @@
+//Standard C++:
+#include <sstream>
+#include <stdexcept>
+//Othello headers:
+#include <othello/util/CpuFeatures.hpp>
+
+
+namespace othello
+{
+
+    namespace util
+    {
+
+        ////////////////////////////////////////////////////////////////
+        uint8_t CpuFeatures::supported = CpuFeatures::detect();
+
+
+        ////////////////////////////////////////////////////////////////
+        uint8_t CpuFeatures::enabled = CpuFeatures::getDefault();
+
+
+        ////////////////////////////////////////////////////////////////
+        uint8_t CpuFeatures::detect()
+        {
+            uint8_t features = NONE;
+
+            #ifdef OTHELLO_X86_KERNELS
+            //This runs before main, so the CPU info may not be loaded yet
+            __builtin_cpu_init();
+
+            //(these also check that the OS saves the vector registers)
+            if (__builtin_cpu_supports("avx2")) {features |= AVX2;}
+            if (__builtin_cpu_supports("bmi2")) {features |= BMI2;}
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("avx512f") &&
+                __builtin_cpu_supports("avx512bw"))
+            {
+                features |= AVX512;
+            }
+            #endif
+
+            return features;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        uint8_t CpuFeatures::getDefault()
+        {
+            uint8_t features = supported;
+
+            #ifdef OTHELLO_X86_KERNELS
+            if (__builtin_cpu_is("znver1") || __builtin_cpu_is("znver2")) {features &= ~BMI2;}
+            #endif
+
+            return features;
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        bool CpuFeatures::isBaselineSupported()
+        {
+            #if defined(OTHELLO_X86_KERNELS) && defined(__POPCNT__)
+            return __builtin_cpu_supports("popcnt");
+            #else
+            return true;
+            #endif
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void CpuFeatures::setEnabled(const uint8_t& features) {enabled = features & supported;}
+
+
+        ////////////////////////////////////////////////////////////////
+        std::string CpuFeatures::toString(const uint8_t& features)
+        {
+            std::string str;
+            if (features & AVX2) {str += "avx2, ";}
+            if (features & BMI2) {str += "bmi2, ";}
+            if (features & AVX512) {str += "avx512, ";}
+
+            //Remove the last separator
+            return str.empty() ? "none" : str.substr(0, str.size() - 2);
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        uint8_t CpuFeatures::fromString(const std::string& str)
+        {
+            uint8_t features = NONE;
+
+            //Read each name between the commas
+            std::istringstream stream(str);
+            std::string name;
+            while (std::getline(stream, name, ','))
+            {
+                //Ignore spaces around the names
+                const std::size_t first = name.find_first_not_of(' ');
+                name = first == std::string::npos ? "" : name.substr(first, name.find_last_not_of(' ') - first + 1);
+
+                if (name == "avx2") {features |= AVX2;}
+                else if (name == "bmi2") {features |= BMI2;}
+                else if (name == "avx512") {features |= AVX512;}
+                else if (name == "all") {features |= ALL;}
+                else if (name != "none") {throw std::invalid_argument("Unknown CPU feature '" + name + "'");}
+            }
+
+            return features;
+        }
+
+    }
+
+}
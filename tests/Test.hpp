@@ -0,0 +1,89 @@
+#ifndef OTHELLO_TEST_HPP
+#define OTHELLO_TEST_HPP
+
+//Standard C++:
+#include <stdexcept>
+#include <string>
+//Boost:
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+//Othello headers:
+#include <othello/game/Board.hpp>
+
+
+////////////////////////////////////////////////////////////////
+/// \brief Macro to fail the running test if a condition is false
+///
+////////////////////////////////////////////////////////////////
+#define OTHELLO_CHECK(condition) \
+    if (!(condition)) \
+    { \
+        throw othello::test::Failure(std::string(__FILE__) + ":" + std::to_string(__LINE__) + ": " + #condition); \
+    }
+
+
+namespace othello
+{
+
+    namespace test
+    {
+
+        ////////////////////////////////////////////////////////////////
+        /// \class Failure
+        ///
+        /// \brief Exception thrown by a failed check
+        ///
+        ////////////////////////////////////////////////////////////////
+        class Failure : public std::runtime_error
+        {
+            public:
+
+                explicit Failure(const std::string& what) : std::runtime_error(what) {}
+
+        };
+
+
+        ////////////////////////////////////////////////////////////////
+        /// \brief Function to play random moves from the start until
+        ///        a position with the given number of empty tiles
+        ///
+        /// Games that end too early are started again, so the position
+        /// is never over
+        ///
+        ////////////////////////////////////////////////////////////////
+        inline game::Board randomPosition(boost::random::mt19937& randomNumberGenerator, const uint8_t& numEmpty)
+        {
+            while (true)
+            {
+                game::Board board;
+                while (!board.isOver() && game::bitboard::popCount(board.getEmptyTiles()) > numEmpty)
+                {
+                    game::bitboard_t legalMoves = board.getLegalMoves();
+                    boost::random::uniform_int_distribution<> distribution(0, game::bitboard::popCount(legalMoves) - 1);
+                    for (int i = distribution(randomNumberGenerator); i > 0; --i) {game::bitboard::popLowest(legalMoves);}
+                    board.applyMove(board.createMove(game::bitboard::lowestIndex(legalMoves)));
+                }
+                if (!board.isOver()) {return board;}
+            }
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        /// \brief The tests, which throw a Failure if they fail
+        ///
+        ////////////////////////////////////////////////////////////////
+        void perft();
+        void zobristHash();
+        void symmetry();
+        void boardBatch();
+        void stability();
+        void positionFeatures();
+        void endgameSolver();
+        void openingBook();
+        void searchAlgorithms();
+
+    }
+
+}
+
+#endif //OTHELLO_TEST_HPP
@@ -0,0 +1,45 @@
+//Standard C++:
+#include <iostream>
+#include <map>
+//Othello headers:
+#include "Test.hpp"
+
+int main(int argc, char** argv)
+{
+    //The tests by name
+    const std::map<std::string, void (*)()> tests = {
+            {"perft", othello::test::perft},
+            {"zobrist-hash", othello::test::zobristHash},
+            {"symmetry", othello::test::symmetry},
+            {"board-batch", othello::test::boardBatch},
+            {"stability", othello::test::stability},
+            {"position-features", othello::test::positionFeatures},
+            {"endgame-solver", othello::test::endgameSolver},
+            {"opening-book", othello::test::openingBook},
+            {"search-algorithms", othello::test::searchAlgorithms}};
+
+    //Run the given test, or all of them
+    int failures = 0;
+    for (const auto& test : tests)
+    {
+        if (argc > 1 && test.first != argv[1]) {continue;}
+        try
+        {
+            test.second();
+            std::cout << test.first << ": passed" << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << test.first << ": FAILED (" << e.what() << ")" << std::endl;
+            ++failures;
+        }
+    }
+
+    //An unknown test fails too
+    if (argc > 1 && !tests.count(argv[1]))
+    {
+        std::cout << "Unknown test '" << argv[1] << "'" << std::endl;
+        return 1;
+    }
+    return failures ? 1 : 0;
+}
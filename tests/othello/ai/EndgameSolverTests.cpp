@@ -0,0 +1,115 @@
+//Standard C++:
+#include <algorithm>
+#include <chrono>
+#include <vector>
+//Othello headers:
+#include <othello/ai/EndgameSolver.hpp>
+#include <othello/ai/TranspositionTable.hpp>
+#include "Test.hpp"
+
+
+namespace othello
+{
+
+    namespace test
+    {
+
+        namespace
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to find the final disk difference of a
+            ///        position by searching every move to the end
+            ///
+            ////////////////////////////////////////////////////////////////
+            int minimax(game::Board& board)
+            {
+                if (board.isOver())
+                {
+                    return int(game::bitboard::popCount(board.getPlayerDisks())) -
+                           int(game::bitboard::popCount(board.getOpponentDisks()));
+                }
+
+                int best = -ai::EndgameSolver::MAX_SCORE;
+                game::bitboard_t legalMoves = board.getLegalMoves();
+                while (legalMoves)
+                {
+                    const uint8_t player = board.getCurrentPlayer();
+                    const game::UndoRecord undo = board.applyMove(board.createMove(game::bitboard::popLowest(legalMoves)));
+                    const int value = board.getCurrentPlayer() == player ? minimax(board) : -minimax(board);
+                    board.undoMove(undo);
+                    best = std::max(best, value);
+                }
+                return best;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get -1, 0 or 1 for a disk difference
+            ///
+            ////////////////////////////////////////////////////////////////
+            int sign(const int& value) {return (value > 0) - (value < 0);}
+
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void endgameSolver()
+        {
+            ai::TranspositionTable table(1u << 20u, false);
+            ai::EndgameSolver solvers[2] = {ai::EndgameSolver(), ai::EndgameSolver(&table)};
+
+            boost::random::mt19937 randomNumberGenerator(3);
+            for (int i = 0; i < 60; ++i)
+            {
+                //Positions on both sides of the last empties solver, and with
+                //and without the table
+                game::Board board = randomPosition(randomNumberGenerator, static_cast<uint8_t>(2 + i % 9));
+                const game::Board original = board;
+
+                //Find the value of every move with minimax
+                std::vector<std::pair<uint8_t, int> > moveValues;
+                game::bitboard_t legalMoves = board.getLegalMoves();
+                while (legalMoves)
+                {
+                    const uint8_t square = game::bitboard::popLowest(legalMoves);
+                    const game::UndoRecord undo = board.applyMove(board.createMove(square));
+                    const int value = board.getCurrentPlayer() == original.getCurrentPlayer() ? minimax(board) : -minimax(board);
+                    board.undoMove(undo);
+                    moveValues.emplace_back(square, value);
+                }
+                int value = -ai::EndgameSolver::MAX_SCORE;
+                for (const auto& moveValue : moveValues) {value = std::max(value, moveValue.second);}
+
+                ai::EndgameSolver& solver = solvers[i % 2];
+                OTHELLO_CHECK(solver.search(board, -ai::EndgameSolver::MAX_SCORE, ai::EndgameSolver::MAX_SCORE) == value);
+                OTHELLO_CHECK(board == original && board.getHash() == original.getHash());
+
+                //Both modes must find the value and every move that gets it
+                std::vector<uint8_t> bestSquares;
+                std::vector<uint8_t> expected;
+                OTHELLO_CHECK(solver.solve(board, ai::EndgameSolver::EXACT, bestSquares) == value);
+                for (const auto& moveValue : moveValues) {if (moveValue.second == value) {expected.push_back(moveValue.first);}}
+                OTHELLO_CHECK(bestSquares == expected);
+
+                expected.clear();
+                OTHELLO_CHECK(solver.solve(board, ai::EndgameSolver::WLD, bestSquares) == sign(value));
+                for (const auto& moveValue : moveValues)
+                {
+                    if (sign(moveValue.second) == sign(value)) {expected.push_back(moveValue.first);}
+                }
+                OTHELLO_CHECK(bestSquares == expected);
+                OTHELLO_CHECK(!solver.isAborted());
+            }
+
+            //A solve that runs out of budget must say so and not give a move
+            ai::EndgameSolver solver(&table);
+            solver.setBudget(std::chrono::milliseconds(0), 1);
+            std::vector<uint8_t> bestSquares;
+            OTHELLO_CHECK(solver.solve(randomPosition(randomNumberGenerator, 20), ai::EndgameSolver::EXACT, bestSquares) == 0);
+            OTHELLO_CHECK(solver.isAborted() && bestSquares.empty());
+        }
+
+    }
+
+}
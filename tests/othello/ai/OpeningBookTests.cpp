@@ -0,0 +1,106 @@
+//Standard C++:
+#include <cstdio>
+#include <fstream>
+#include <vector>
+//Othello headers:
+#include <othello/ai/OpeningBook.hpp>
+#include <othello/game/Symmetry.hpp>
+#include "Test.hpp"
+
+
+namespace othello
+{
+
+    namespace test
+    {
+
+        namespace
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to determine if opening a book file throws
+            ///
+            ////////////////////////////////////////////////////////////////
+            bool isRejected(const std::string& path)
+            {
+                try {ai::OpeningBook book(path);}
+                catch (const std::runtime_error&) {return true;}
+                return false;
+            }
+
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void openingBook()
+        {
+            const std::string path = "othello-tests.book";
+            const uint8_t bookDepth = 3;
+            const std::size_t size = ai::OpeningBook::build(path, bookDepth, 2, 2, 1u << 20u, 1);
+
+            {
+                const ai::OpeningBook book(path);
+                OTHELLO_CHECK(book.size() == size);
+
+                //Every position up to the book depth must be found in every
+                //symmetry, with a move that gets its value
+                std::vector<game::Board> positions(1);
+                for (uint8_t depth = 0; depth <= bookDepth + 1; ++depth)
+                {
+                    std::vector<game::Board> next;
+                    for (const game::Board& board : positions)
+                    {
+                        ai::OpeningBook::Entry entry = {};
+                        OTHELLO_CHECK(book.probe(board, entry) == (depth <= bookDepth));
+                        if (depth > bookDepth) {continue;}
+                        for (uint8_t s = 1; s < game::symmetry::NUM_SYMMETRIES; ++s)
+                        {
+                            //(Symmetrical positions can get another of the best moves)
+                            const game::Board transformed = board.transform(s);
+                            ai::OpeningBook::Entry transformedEntry = {};
+                            OTHELLO_CHECK(book.probe(transformed, transformedEntry));
+                            OTHELLO_CHECK(transformedEntry.value == entry.value);
+                            OTHELLO_CHECK(transformedEntry.move == ai::OpeningBook::NO_MOVE ? entry.move == transformedEntry.move :
+                                          (transformed.getLegalMoves() & game::bitboard::toBit(transformedEntry.move)) != 0);
+                        }
+
+                        //The last positions only have a value
+                        OTHELLO_CHECK((entry.move == ai::OpeningBook::NO_MOVE) == (depth == bookDepth));
+                        if (entry.move != ai::OpeningBook::NO_MOVE)
+                        {
+                            OTHELLO_CHECK(board.getLegalMoves() & game::bitboard::toBit(entry.move));
+                            game::Board child = board;
+                            child.applyMove(child.createMove(entry.move));
+                            ai::OpeningBook::Entry childEntry = {};
+                            OTHELLO_CHECK(book.probe(child, childEntry));
+                            OTHELLO_CHECK(entry.value == (child.getCurrentPlayer() == board.getCurrentPlayer() ?
+                                                          childEntry.value : -childEntry.value));
+                        }
+
+                        game::bitboard_t legalMoves = board.getLegalMoves();
+                        while (legalMoves)
+                        {
+                            next.push_back(board);
+                            next.back().applyMove(board.createMove(game::bitboard::popLowest(legalMoves)));
+                        }
+                    }
+                    positions = std::move(next);
+                }
+            }
+
+            //Files that aren't whole books must be rejected
+            OTHELLO_CHECK(isRejected("othello-tests.missing"));
+            std::ifstream in(path, std::ios::binary);
+            const std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            in.close();
+            std::ofstream(path, std::ios::binary).write(bytes.data(), bytes.size() - 1);
+            OTHELLO_CHECK(isRejected(path));
+            std::ofstream(path, std::ios::binary) << "Not a book, but long enough to have a header";
+            OTHELLO_CHECK(isRejected(path));
+
+            std::remove(path.c_str());
+        }
+
+    }
+
+}
@@ -0,0 +1,71 @@
+//Standard C++:
+#include <chrono>
+#include <memory>
+#include <vector>
+//Othello headers:
+#include <othello/ai/AlphaBetaPruningPlayer.hpp>
+#include "Test.hpp"
+
+
+namespace othello
+{
+
+    namespace test
+    {
+
+        namespace
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to create a single-threaded player that only
+            ///        searches (no solving or ProbCut)
+            ///
+            ////////////////////////////////////////////////////////////////
+            std::unique_ptr<ai::AlphaBetaPruningPlayer> createSearcher(const std::size_t& hashSize,
+                    const uint8_t& moveOrdering, const ai::AlphaBetaPruningPlayer::Algorithm& algorithm)
+            {
+                return std::unique_ptr<ai::AlphaBetaPruningPlayer>(new ai::AlphaBetaPruningPlayer(
+                        1, std::chrono::milliseconds(0), 0, 0, 1, hashSize, false, moveOrdering, algorithm, 0,
+                        ai::EndgameSolver::EXACT, ai::ProbCut(0)));
+            }
+
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void searchAlgorithms()
+        {
+            boost::random::mt19937 randomNumberGenerator(6);
+            for (int i = 0; i < 40; ++i)
+            {
+                const uint8_t numEmpty = static_cast<uint8_t>(
+                        12 + i % (game::Board::BOARD_SIZE * game::Board::BOARD_SIZE - 16));
+                const game::Board board = randomPosition(randomNumberGenerator, numEmpty);
+
+                //Plain alpha-beta without a table or move ordering, and searches
+                //that rely on the table (a small one too, so entries are replaced).
+                //Each position gets new tables, as deeper entries for it left by
+                //another position's search would change its value
+                std::vector<std::unique_ptr<ai::AlphaBetaPruningPlayer> > searchers;
+                searchers.push_back(createSearcher(0, ai::MoveOrderer::NONE, ai::AlphaBetaPruningPlayer::ALPHA_BETA));
+                searchers.push_back(createSearcher(1u << 22u, ai::MoveOrderer::ALL, ai::AlphaBetaPruningPlayer::PVS));
+                searchers.push_back(createSearcher(1u << 22u, ai::MoveOrderer::ALL, ai::AlphaBetaPruningPlayer::MTDF));
+                searchers.push_back(createSearcher(1u << 12u, ai::MoveOrderer::ALL, ai::AlphaBetaPruningPlayer::PVS));
+                searchers.push_back(createSearcher(1u << 12u, ai::MoveOrderer::ALL, ai::AlphaBetaPruningPlayer::MTDF));
+
+                //Every search must find the same value, one ply deeper at a time
+                //like iterative deepening
+                for (uint8_t depth = 1; depth <= 5; ++depth)
+                {
+                    const int64_t value = searchers[0]->search(board, depth);
+                    for (std::size_t s = 1; s < searchers.size(); ++s)
+                    {
+                        OTHELLO_CHECK(searchers[s]->search(board, depth) == value);
+                    }
+                }
+            }
+        }
+
+    }
+
+}
@@ -0,0 +1,136 @@
+//Standard C++:
+#include <stdexcept>
+#include <vector>
+//Othello headers:
+#include <othello/ai/MoveEvaluator.hpp>
+#include <othello/game/BoardBatch.hpp>
+#include <othello/util/CpuFeatures.hpp>
+#include "Test.hpp"
+
+
+namespace othello
+{
+
+    namespace test
+    {
+
+        namespace
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to check every kernel of a batch against the
+            ///        one-board functions, with the enabled CPU features
+            ///
+            ////////////////////////////////////////////////////////////////
+            void checkBoardBatch(boost::random::mt19937& randomNumberGenerator)
+            {
+                //Batch sizes that leave boards over for the narrower kernels
+                const std::size_t sizes[] = {1, 3, 8, 13, 37};
+                for (const std::size_t& size : sizes)
+                {
+                    std::vector<game::Board> boards;
+                    game::BoardBatch batch;
+                    for (std::size_t i = 0; i < size; ++i)
+                    {
+                        boards.push_back(randomPosition(randomNumberGenerator, static_cast<uint8_t>(
+                                4 + i * 7 % (game::Board::BOARD_SIZE * game::Board::BOARD_SIZE - 8))));
+                        batch.add(boards.back());
+                    }
+
+                    //Weighted disk counts, with a group per row and one for the
+                    //corners
+                    std::vector<game::bitboard_t> masks = {game::bitboard::toBit(0) | game::bitboard::toBit(63)};
+                    std::vector<int64_t> weights = {25};
+                    for (uint8_t y = 0; y < game::Board::BOARD_SIZE; ++y)
+                    {
+                        masks.push_back((0xFFULL << (y * game::bitboard::ROW_SIZE)) & game::bitboard::VALID_TILES);
+                        weights.push_back(int64_t(y) - 3);
+                    }
+                    std::vector<int64_t> scores(size);
+                    batch.getWeightedDiskCounts(1, masks.data(), weights.data(), masks.size(), scores.data());
+                    for (std::size_t i = 0; i < size; ++i)
+                    {
+                        int64_t score = 0;
+                        for (std::size_t g = 0; g < masks.size(); ++g)
+                        {
+                            score += weights[g] * (int64_t(game::bitboard::popCount(boards[i].getDisks(1) & masks[g])) -
+                                                   int64_t(game::bitboard::popCount(boards[i].getDisks(0) & masks[g])));
+                        }
+                        OTHELLO_CHECK(scores[i] == score);
+                    }
+
+                    //Making a random move on every board
+                    std::vector<uint8_t> squares(size);
+                    for (std::size_t i = 0; i < size; ++i)
+                    {
+                        game::bitboard_t legalMoves = boards[i].getLegalMoves();
+                        boost::random::uniform_int_distribution<> distribution(0, game::bitboard::popCount(legalMoves) - 1);
+                        for (int m = distribution(randomNumberGenerator); m > 0; --m) {game::bitboard::popLowest(legalMoves);}
+                        squares[i] = game::bitboard::lowestIndex(legalMoves);
+                        boards[i].applyMove(boards[i].createMove(squares[i]));
+                    }
+                    batch.makeMoves(squares.data());
+                    for (std::size_t i = 0; i < size; ++i)
+                    {
+                        OTHELLO_CHECK(batch.getBoard(i) == boards[i]);
+                        OTHELLO_CHECK(batch.getLegalMoves()[i] == boards[i].getLegalMoves());
+                        OTHELLO_CHECK(batch.getCurrentPlayers()[i] == boards[i].getCurrentPlayer());
+                    }
+
+                    //An illegal move mustn't change any board
+                    squares[size - 1] = game::bitboard::lowestIndex(boards[size - 1].getOccupiedTiles());
+                    bool thrown = false;
+                    try {batch.makeMoves(squares.data());}
+                    catch (const std::invalid_argument&) {thrown = true;}
+                    OTHELLO_CHECK(thrown);
+                    for (std::size_t i = 0; i < size; ++i) {OTHELLO_CHECK(batch.getBoard(i) == boards[i]);}
+
+                    //The children of each board, with their legal moves and values
+                    for (const game::Board& board : boards)
+                    {
+                        if (board.isOver()) {continue;}
+                        int64_t values[game::MoveList::MAX_MOVES];
+                        const std::size_t numChildren = ai::MoveEvaluator::evaluateChildren(board, 0, batch, values);
+                        game::MoveList possibleMoves;
+                        board.getPossibleMoves(possibleMoves);
+                        OTHELLO_CHECK(numChildren == possibleMoves.size() && batch.size() == numChildren);
+                        for (std::size_t i = 0; i < numChildren; ++i)
+                        {
+                            game::Board child = board;
+                            child.applyMove(possibleMoves[i]);
+                            OTHELLO_CHECK(batch.getBoard(i) == child);
+                            OTHELLO_CHECK(batch.getLegalMoves()[i] == child.getLegalMoves());
+                            OTHELLO_CHECK(values[i] == ai::MoveEvaluator::evaluate(child, 0));
+                        }
+                    }
+                }
+            }
+
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void boardBatch()
+        {
+            //Check the kernels with every instruction set the CPU has
+            const uint8_t enabled = util::CpuFeatures::getEnabled();
+            const uint8_t levels[] = {util::CpuFeatures::NONE, util::CpuFeatures::AVX2,
+                                      util::CpuFeatures::AVX2 | util::CpuFeatures::AVX512};
+            for (const uint8_t& level : levels)
+            {
+                if ((util::CpuFeatures::getSupported() & level) != level) {continue;}
+                util::CpuFeatures::setEnabled(level);
+                boost::random::mt19937 randomNumberGenerator(4);
+                try {checkBoardBatch(randomNumberGenerator);}
+                catch (const Failure& failure)
+                {
+                    util::CpuFeatures::setEnabled(enabled);
+                    throw Failure(std::string(failure.what()) + " (with " + util::CpuFeatures::toString(level) + ")");
+                }
+            }
+            util::CpuFeatures::setEnabled(enabled);
+        }
+
+    }
+
+}
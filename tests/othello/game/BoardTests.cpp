@@ -0,0 +1,121 @@
+//Standard C++:
+#include <vector>
+//Othello headers:
+#include <othello/game/Perft.hpp>
+#include <othello/game/Symmetry.hpp>
+#include "Test.hpp"
+
+
+namespace othello
+{
+
+    namespace test
+    {
+
+        ////////////////////////////////////////////////////////////////
+        void perft()
+        {
+            //The number of leaves from the start after 1 to 9 moves (with
+            //passes counted as moves)
+            #if OTHELLO_BOARD_SIZE == 6
+            const std::vector<uint64_t> counts = {4, 12, 56, 244, 1364, 7604, 47740, 308716, 2114912};
+            #else
+            const std::vector<uint64_t> counts = {4, 12, 56, 244, 1396, 8200, 55092, 390216, 3005288};
+            #endif
+
+            const game::Board board;
+            for (uint8_t depth = 1; depth <= counts.size(); ++depth)
+            {
+                OTHELLO_CHECK(game::Perft::count(board, depth) == counts[depth - 1]);
+            }
+
+            //The threads and the hash table mustn't change the counts
+            OTHELLO_CHECK(game::Perft::count(board, 8, 2, 1u << 16u) == counts[7]);
+            uint64_t total = 0;
+            for (const auto& move : game::Perft::divide(board, 7)) {total += move.second;}
+            OTHELLO_CHECK(total == counts[6]);
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void zobristHash()
+        {
+            boost::random::mt19937 randomNumberGenerator(1);
+            for (int i = 0; i < 100; ++i)
+            {
+                //Play a random game, checking the incremental hash against a
+                //full hash after every move
+                game::Board board;
+                std::vector<game::Board> boards;
+                std::vector<game::UndoRecord> undos;
+                while (!board.isOver())
+                {
+                    boards.push_back(board);
+                    game::bitboard_t legalMoves = board.getLegalMoves();
+                    boost::random::uniform_int_distribution<> distribution(0, game::bitboard::popCount(legalMoves) - 1);
+                    for (int m = distribution(randomNumberGenerator); m > 0; --m) {game::bitboard::popLowest(legalMoves);}
+                    undos.push_back(board.applyMove(board.createMove(game::bitboard::lowestIndex(legalMoves))));
+
+                    const std::array<game::bitboard_t, 2> disks = {board.getDisks(0), board.getDisks(1)};
+                    OTHELLO_CHECK(board.getHash() == game::zobrist::hash(disks, board.getCurrentPlayer()));
+                }
+
+                //Undoing the moves must give back the same positions and hashes
+                while (!undos.empty())
+                {
+                    board.undoMove(undos.back());
+                    OTHELLO_CHECK(board == boards.back());
+                    OTHELLO_CHECK(board.getHash() == boards.back().getHash());
+                    OTHELLO_CHECK(board.getLegalMoves() == boards.back().getLegalMoves());
+                    undos.pop_back();
+                    boards.pop_back();
+                }
+            }
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void symmetry()
+        {
+            //Every tile must go back to itself through the inverse symmetry
+            for (uint8_t s = 0; s < game::symmetry::NUM_SYMMETRIES; ++s)
+            {
+                game::bitboard_t tiles = game::bitboard::VALID_TILES;
+                while (tiles)
+                {
+                    const uint8_t index = game::bitboard::popLowest(tiles);
+                    const uint8_t transformed = game::symmetry::transformIndex(index, s);
+                    OTHELLO_CHECK(game::bitboard::toBit(transformed) & game::bitboard::VALID_TILES);
+                    OTHELLO_CHECK(game::symmetry::transformIndex(transformed, game::symmetry::inverse(s)) == index);
+                }
+            }
+
+            boost::random::mt19937 randomNumberGenerator(2);
+            for (int i = 0; i < 200; ++i)
+            {
+                //Positions from the start to a few empty tiles from the end
+                const uint8_t numEmpty = static_cast<uint8_t>(4 + i % (game::Board::BOARD_SIZE * game::Board::BOARD_SIZE - 8));
+                const game::Board board = randomPosition(randomNumberGenerator, numEmpty);
+                const std::pair<game::Board, uint8_t> canonical = board.getCanonical();
+                OTHELLO_CHECK(canonical.first == board.transform(canonical.second));
+
+                for (uint8_t s = 0; s < game::symmetry::NUM_SYMMETRIES; ++s)
+                {
+                    //The transformed board must be the same position, turned
+                    const game::Board transformed = board.transform(s);
+                    OTHELLO_CHECK(transformed.transform(game::symmetry::inverse(s)) == board);
+                    OTHELLO_CHECK(transformed.getHash() == game::Board(
+                            {transformed.getDisks(0), transformed.getDisks(1)}, transformed.getCurrentPlayer()).getHash());
+                    OTHELLO_CHECK(transformed.getLegalMoves() == game::symmetry::transform(board.getLegalMoves(), s));
+
+                    //Every symmetry has the same canonical form
+                    const std::pair<game::Board, uint8_t> transformedCanonical = transformed.getCanonical();
+                    OTHELLO_CHECK(transformedCanonical.first == canonical.first);
+                    OTHELLO_CHECK(transformedCanonical.first.getHash() == canonical.first.getHash());
+                }
+            }
+        }
+
+    }
+
+}
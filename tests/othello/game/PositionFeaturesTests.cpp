@@ -0,0 +1,144 @@
+//Othello headers:
+#include <othello/game/PositionFeatures.hpp>
+#include <othello/game/Stability.hpp>
+#include "Test.hpp"
+
+
+namespace othello
+{
+
+    namespace test
+    {
+
+        namespace
+        {
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief The value of tiles that are empty or off the board
+            ///
+            ////////////////////////////////////////////////////////////////
+            constexpr int NO_DISK = 2;
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to get the player whose disk is on a tile,
+            ///        or NO_DISK
+            ///
+            ////////////////////////////////////////////////////////////////
+            int getDisk(const game::Board& board, const int& x, const int& y)
+            {
+                if (x < 0 || y < 0 || x >= game::Board::BOARD_SIZE || y >= game::Board::BOARD_SIZE) {return NO_DISK;}
+                const game::bitboard_t bit = game::bitboard::toBit(game::bitboard::toIndex(
+                        {static_cast<uint8_t>(x), static_cast<uint8_t>(y)}));
+                if (board.getDisks(0) & bit) {return 0;}
+                if (board.getDisks(1) & bit) {return 1;}
+                return NO_DISK;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to determine if a tile is on the board and
+            ///        empty
+            ///
+            ////////////////////////////////////////////////////////////////
+            bool isEmpty(const game::Board& board, const int& x, const int& y)
+            {
+                return x >= 0 && y >= 0 && x < game::Board::BOARD_SIZE && y < game::Board::BOARD_SIZE &&
+                       getDisk(board, x, y) == NO_DISK;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to determine if a player could play on a
+            ///        tile, by walking from it in every direction
+            ///
+            ////////////////////////////////////////////////////////////////
+            bool isLegalMove(const game::Board& board, const uint8_t& player, const int& x, const int& y)
+            {
+                if (!isEmpty(board, x, y)) {return false;}
+                for (int dy = -1; dy <= 1; ++dy)
+                {
+                    for (int dx = -1; dx <= 1; ++dx)
+                    {
+                        //The other player's disks, then one of the player's
+                        int distance = 1;
+                        while (getDisk(board, x + distance * dx, y + distance * dy) == !player) {++distance;}
+                        if (distance > 1 && getDisk(board, x + distance * dx, y + distance * dy) == player) {return true;}
+                    }
+                }
+                return false;
+            }
+
+
+            ////////////////////////////////////////////////////////////////
+            /// \brief Function to determine if any tile next to a tile
+            ///        holds the given disk (or is empty for NO_DISK)
+            ///
+            ////////////////////////////////////////////////////////////////
+            bool hasNeighbour(const game::Board& board, const int& x, const int& y, const int& disk)
+            {
+                for (int dy = -1; dy <= 1; ++dy)
+                {
+                    for (int dx = -1; dx <= 1; ++dx)
+                    {
+                        if (dx == 0 && dy == 0) {continue;}
+                        if (disk == NO_DISK ? isEmpty(board, x + dx, y + dy) : getDisk(board, x + dx, y + dy) == disk)
+                        {
+                            return true;
+                        }
+                    }
+                }
+                return false;
+            }
+
+        }
+
+
+        ////////////////////////////////////////////////////////////////
+        void positionFeatures()
+        {
+            //Compare the bitboard features with counting them tile by tile
+            //(on the board size this is built for)
+            const int half = game::Board::BOARD_SIZE / 2;
+            boost::random::mt19937 randomNumberGenerator(7);
+            for (int i = 0; i < 400; ++i)
+            {
+                const uint8_t numEmpty = static_cast<uint8_t>(1 + i % (game::Board::BOARD_SIZE * game::Board::BOARD_SIZE - 4));
+                const game::Board board = randomPosition(randomNumberGenerator, numEmpty);
+
+                game::PositionFeatures::Features expected{};
+                for (int y = 0; y < game::Board::BOARD_SIZE; ++y)
+                {
+                    for (int x = 0; x < game::Board::BOARD_SIZE; ++x)
+                    {
+                        const int disk = getDisk(board, x, y);
+                        if (disk == NO_DISK)
+                        {
+                            ++expected.numEmpty;
+                            expected.parity ^= 1u << ((y >= half) * 2 + (x >= half));
+                            for (uint8_t p = 0; p < 2; ++p)
+                            {
+                                expected.mobility[p] += isLegalMove(board, p, x, y);
+                                expected.potentialMobility[p] += hasNeighbour(board, x, y, !p);
+                            }
+                        }
+                        else {expected.frontier[disk] += hasNeighbour(board, x, y, NO_DISK);}
+                    }
+                }
+
+                const game::PositionFeatures::Features features = game::PositionFeatures::getFeatures(board);
+                for (uint8_t p = 0; p < 2; ++p)
+                {
+                    OTHELLO_CHECK(features.mobility[p] == expected.mobility[p]);
+                    OTHELLO_CHECK(features.frontier[p] == expected.frontier[p]);
+                    OTHELLO_CHECK(features.potentialMobility[p] == expected.potentialMobility[p]);
+                    OTHELLO_CHECK(features.stable[p] == game::Stability::getStableDiskCount(board, p));
+                }
+                OTHELLO_CHECK(features.parity == expected.parity);
+                OTHELLO_CHECK(features.numEmpty == expected.numEmpty);
+            }
+        }
+
+    }
+
+}
@@ -0,0 +1,60 @@
+//Othello headers:
+#include <othello/game/Stability.hpp>
+#include "Test.hpp"
+
+
+namespace othello
+{
+
+    namespace test
+    {
+
+        ////////////////////////////////////////////////////////////////
+        void stability()
+        {
+            //The endgame solver prunes with the stable disks, so they must never
+            //be flipped, whatever is played (checked on the board size this is
+            //built for, as 6x6 boards only use some of the tiles)
+            boost::random::mt19937 randomNumberGenerator(5);
+            for (int i = 0; i < 400; ++i)
+            {
+                const uint8_t numEmpty = static_cast<uint8_t>(4 + i % (game::Board::BOARD_SIZE * game::Board::BOARD_SIZE - 8));
+                const game::Board position = randomPosition(randomNumberGenerator, numEmpty);
+                const game::bitboard_t stable[2] = {
+                        game::Stability::getStableDisks(position.getDisks(0), position.getDisks(1)),
+                        game::Stability::getStableDisks(position.getDisks(1), position.getDisks(0))};
+                for (uint8_t player = 0; player < 2; ++player)
+                {
+                    OTHELLO_CHECK((stable[player] & ~position.getDisks(player)) == 0);
+                    OTHELLO_CHECK(game::Stability::getStableDiskCount(position, player) ==
+                                  game::bitboard::popCount(stable[player]));
+                }
+                const int lowerBound = game::Stability::getScoreLowerBound(position, 0);
+                const int upperBound = game::Stability::getScoreUpperBound(position, 0);
+
+                //Play a few random games to the end from the position
+                for (int playout = 0; playout < 8; ++playout)
+                {
+                    game::Board board = position;
+                    while (!board.isOver())
+                    {
+                        game::bitboard_t legalMoves = board.getLegalMoves();
+                        boost::random::uniform_int_distribution<> distribution(0, game::bitboard::popCount(legalMoves) - 1);
+                        for (int m = distribution(randomNumberGenerator); m > 0; --m) {game::bitboard::popLowest(legalMoves);}
+                        board.applyMove(board.createMove(game::bitboard::lowestIndex(legalMoves)));
+
+                        OTHELLO_CHECK((board.getDisks(0) & stable[0]) == stable[0]);
+                        OTHELLO_CHECK((board.getDisks(1) & stable[1]) == stable[1]);
+                    }
+
+                    //The final score must be within the bounds
+                    const int score = int(game::bitboard::popCount(board.getDisks(0))) -
+                                      int(game::bitboard::popCount(board.getDisks(1)));
+                    OTHELLO_CHECK(lowerBound <= score && score <= upperBound);
+                }
+            }
+        }
+
+    }
+
+}